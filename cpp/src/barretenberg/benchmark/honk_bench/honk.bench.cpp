@@ -1,3 +1,5 @@
+#include "barretenberg/common/peak_rss.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/honk/proof_system/prover.hpp"
 #include "barretenberg/honk/proof_system/verifier.hpp"
@@ -76,12 +78,48 @@ void construct_proof_bench(State& state) noexcept
         auto proof = ext_prover.construct_proof();
     }
     state.SetComplexityN(num_gates); // Set up for computation of constant C where prover ~ C*N
+    // The high-water mark of the process so far, so of the largest circuit proven up to this benchmark
+    state.counters["peak_rss_kB"] = static_cast<double>(get_peak_rss());
 }
 BENCHMARK(construct_proof_bench)
     ->DenseRange(MIN_LOG_NUM_GATES, MAX_LOG_NUM_GATES, 1)
     ->Repetitions(NUM_REPETITIONS)
     ->Complexity(oN);
 
+/**
+ * @brief Benchmark: Sumcheck (the relation check rounds) of a Standard Honk proof, on `state.range(1)` threads
+ *
+ * @details Only the sumcheck runs on that many threads: the rounds before it run on the default number, which sized
+ * the pippenger runtime states.
+ */
+void sumcheck_threads_bench(State& state) noexcept
+{
+    const size_t default_num_threads = barretenberg::get_num_threads();
+    auto num_gates = 1 << (size_t)state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto composer = honk::StandardHonkComposer(static_cast<size_t>(num_gates));
+        generate_test_plonk_circuit(composer, static_cast<size_t>(num_gates));
+        auto ext_prover = composer.create_prover();
+        ext_prover.execute_preamble_round();
+        ext_prover.execute_wire_commitments_round();
+        ext_prover.execute_tables_round();
+        ext_prover.execute_grand_product_computation_round();
+        barretenberg::set_num_threads(static_cast<size_t>(state.range(1)));
+        state.ResumeTiming();
+
+        ext_prover.execute_relation_check_rounds();
+
+        state.PauseTiming();
+        barretenberg::set_num_threads(default_num_threads);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(sumcheck_threads_bench)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_GATES, MAX_LOG_NUM_GATES, 1), { 1, 2, 4, 8, 16 } })
+    ->Unit(kMillisecond)
+    ->UseRealTime();
+
 /**
  * @brief Benchmark: Verification of a Standard Honk proof
  */
@@ -106,4 +144,40 @@ void verify_proof_bench(State& state) noexcept
 // Note: disabling this bench for now since it is not of primary interest
 // BENCHMARK(verify_proof_bench)->DenseRange(MIN_LOG_NUM_GATES, MAX_LOG_NUM_GATES, 1)->Iterations(1);
 
+constexpr size_t BATCH_VERIFY_GATES = 1 << 12;
+constexpr size_t MAX_BATCH_VERIFY_PROOFS = 64;
+
+/**
+ * @brief Benchmark: Verification of a batch of `state.range(0)` Standard Honk proofs of one circuit with one pairing
+ * check, as proofs per second. A batch of one is the cost of verify_proof.
+ */
+void verify_proofs_batch_bench(State& state) noexcept
+{
+    static std::vector<plonk::proof> batch_proofs;
+    static honk::StandardHonkComposer composer(BATCH_VERIFY_GATES);
+    if (batch_proofs.empty()) {
+        generate_test_plonk_circuit(composer, BATCH_VERIFY_GATES);
+        for (size_t i = 0; i < MAX_BATCH_VERIFY_PROOFS; ++i) {
+            // same circuit, fresh witness
+            auto instance = honk::StandardHonkComposer(BATCH_VERIFY_GATES);
+            generate_test_plonk_circuit(instance, BATCH_VERIFY_GATES);
+            batch_proofs.push_back(instance.create_prover().construct_proof());
+        }
+    }
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    const std::vector<plonk::proof> batch(batch_proofs.begin(),
+                                          batch_proofs.begin() + static_cast<std::ptrdiff_t>(batch_size));
+    auto verifier = composer.create_verifier();
+    for (auto _ : state) {
+        DoNotOptimize(verifier.verify_proofs(batch));
+    }
+    state.counters["proofs_per_second"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(batch_size), Counter::kIsRate);
+}
+BENCHMARK(verify_proofs_batch_bench)
+    ->RangeMultiplier(4)
+    ->Range(1, MAX_BATCH_VERIFY_PROOFS)
+    ->Unit(kMillisecond)
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -1,9 +1,23 @@
 #include <chrono>
 #include "barretenberg/common/assert.hpp"
+#include <algorithm>
 #include <cstdlib>
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_state_pool.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/bucket_width_table.hpp"
+#include "barretenberg/common/peak_rss.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/srs/reference_string/file_reference_string.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <limits>
+#include <random>
+#include <string>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -38,10 +52,26 @@ using namespace barretenberg;
 //     return acc;
 // }
 constexpr size_t NUM_POINTS = 1 << 16;
+// MSM sizes of the bucket strategy sweep
+constexpr size_t MIN_SWEEP_LOG_POINTS = 16;
+constexpr size_t MAX_SWEEP_LOG_POINTS = 22;
+constexpr size_t MAX_SWEEP_POINTS = 1 << MAX_SWEEP_LOG_POINTS;
 std::vector<fr> scalars;
 static barretenberg::evaluation_domain small_domain;
 static barretenberg::evaluation_domain large_domain;
-auto reference_string = std::make_shared<bonk::FileReferenceString>(NUM_POINTS, "../srs_db/ignition");
+// The SRS is loaded on first use rather than at startup, with the points of the largest MSM of the mode being run (set
+// in `main`), so that modes which need fewer points also run against a smaller transcript
+size_t max_num_points = std::max(NUM_POINTS, MAX_SWEEP_POINTS);
+std::shared_ptr<bonk::FileReferenceString> reference_string;
+
+g1::affine_element* get_monomial_points(const size_t num_points)
+{
+    ASSERT(num_points <= max_num_points);
+    if (!reference_string) {
+        reference_string = std::make_shared<bonk::FileReferenceString>(max_num_points, "../srs_db/ignition");
+    }
+    return reference_string->get_monomial_points();
+}
 
 const auto init = []() {
     small_domain = barretenberg::evaluation_domain(NUM_POINTS);
@@ -49,8 +79,9 @@ const auto init = []() {
 
     fr element = fr::random_element();
     fr accumulator = element;
-    scalars.reserve(NUM_POINTS * 4);
-    for (size_t i = 0; i < NUM_POINTS * 4; ++i) {
+    const size_t num_scalars = std::max(NUM_POINTS * 4, MAX_SWEEP_POINTS);
+    scalars.reserve(num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
         accumulator *= element;
         scalars.emplace_back(accumulator);
     }
@@ -61,12 +92,22 @@ const auto init = []() {
 };
 // constexpr double add_to_mixed_add_complexity = 1.36;
 
+void print_runtime_state_pool_stats()
+{
+    const auto stats = scalar_multiplication::get_runtime_state_pool().get_stats();
+    std::cout << "runtime state pool: " << stats.num_checkouts << " checkouts, " << stats.num_allocations
+              << " allocations, " << stats.num_bytes_allocated << " bytes allocated, " << stats.num_idle_states
+              << " idle states" << std::endl;
+    std::cout << "scalars: " << stats.scalar_counts.num_zero << " zero, " << stats.scalar_counts.num_one << " one, "
+              << stats.scalar_counts.num_small << " small, " << stats.scalar_counts.num_large << " large" << std::endl;
+    std::cout << "peak rss: " << get_peak_rss() << "kB" << std::endl;
+}
+
 int pippenger()
 {
-    scalar_multiplication::pippenger_runtime_state state(NUM_POINTS);
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
-    g1::element result = scalar_multiplication::pippenger_unsafe(
-        &scalars[0], reference_string->get_monomial_points(), NUM_POINTS, state);
+    g1::element result = scalar_multiplication::get_runtime_state_pool().pippenger_unsafe(
+        &scalars[0], get_monomial_points(NUM_POINTS), NUM_POINTS);
     std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
     std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
     std::cout << "run time: " << diff.count() << "us" << std::endl;
@@ -74,6 +115,258 @@ int pippenger()
     return 0;
 }
 
+// memory the fixed-base run may spend on shifted copies of the point table (and the larger runtime state)
+constexpr size_t FIXED_BASE_MEMORY_BUDGET = 4ULL << 30;
+
+int pippenger_fixed_base()
+{
+    const size_t num_shifts = scalar_multiplication::get_fixed_base_num_shifts(NUM_POINTS, FIXED_BASE_MEMORY_BUDGET);
+    scalar_multiplication::fixed_base_point_table table{
+        nullptr, NUM_POINTS, num_shifts, scalar_multiplication::get_optimal_bucket_width(NUM_POINTS)
+    };
+    table.points = (g1::affine_element*)aligned_alloc(
+        64, scalar_multiplication::get_fixed_base_table_size(NUM_POINTS, num_shifts) * sizeof(g1::affine_element));
+    scalar_multiplication::generate_fixed_base_point_table(get_monomial_points(NUM_POINTS), table);
+    auto state = scalar_multiplication::get_runtime_state_pool().checkout(NUM_POINTS, num_shifts);
+
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result = scalar_multiplication::pippenger_fixed_base_unsafe(&scalars[0], table, 0, NUM_POINTS, *state);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "fixed-base run time (" << num_shifts << " shifts): " << diff.count() << "us" << std::endl;
+    std::cout << result.x << std::endl;
+    aligned_free(table.points);
+    return 0;
+}
+
+// time every bucket accumulation strategy over the sweep sizes; `select_bucket_strategy` should pick the fastest
+int pippenger_bucket_strategies()
+{
+    scalar_multiplication::pippenger_runtime_state state(MAX_SWEEP_POINTS);
+    for (size_t log_num_points = MIN_SWEEP_LOG_POINTS; log_num_points <= MAX_SWEEP_LOG_POINTS; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        for (const auto strategy : { scalar_multiplication::SORTED_BUCKETS, scalar_multiplication::AFFINE_BUCKETS }) {
+            state.bucket_strategy = strategy;
+            std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+            scalar_multiplication::pippenger_unsafe(&scalars[0], get_monomial_points(num_points), num_points, state);
+            std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+            std::chrono::microseconds diff =
+                std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+            std::cout << "2^" << log_num_points << " points, "
+                      << (strategy == scalar_multiplication::SORTED_BUCKETS ? "sorted" : "affine")
+                      << " buckets: " << diff.count() << "us" << std::endl;
+        }
+        const bool selects_affine = scalar_multiplication::select_bucket_strategy(
+                                        scalar_multiplication::AUTO_BUCKETS, num_points) ==
+                                    scalar_multiplication::AFFINE_BUCKETS;
+        std::cout << "2^" << log_num_points << " points, auto selects " << (selects_affine ? "affine" : "sorted")
+                  << " buckets" << std::endl;
+    }
+    return 0;
+}
+
+// calibration tries every bucket width within this distance of `get_optimal_bucket_width`
+constexpr size_t CALIBRATION_WIDTH_RADIUS = 3;
+// MSMs below this size are timed several times, keeping the fastest run
+constexpr size_t CALIBRATION_REPEAT_LOG_POINTS = 20;
+constexpr size_t CALIBRATION_NUM_REPEATS = 3;
+
+/**
+ * Measure the fastest bucket width for every MSM size from 2^MIN_CALIBRATED_LOG_POINTS to 2^max_log_num_points, at
+ * every power-of-two thread count, and write the bucket width table that pippenger runtime states load at startup.
+ **/
+int calibrate_bucket_widths(const size_t max_log_num_points)
+{
+    // the table is written to the file it is read from, which must be named explicitly
+    const char* path = std::getenv(scalar_multiplication::BUCKET_WIDTH_TABLE_ENV_VAR);
+    if (path == nullptr) {
+        std::cout << "set " << scalar_multiplication::BUCKET_WIDTH_TABLE_ENV_VAR << " to the calibration file to write"
+                  << std::endl;
+        return 1;
+    }
+    const std::string table_path = path;
+    const size_t max_num_points = 1UL << max_log_num_points;
+    auto calibration_reference_string =
+        std::make_shared<bonk::FileReferenceString>(max_num_points, "../srs_db/ignition");
+    g1::affine_element* points = calibration_reference_string->get_monomial_points();
+    std::vector<fr> calibration_scalars(max_num_points);
+    for (auto& scalar : calibration_scalars) {
+        scalar = fr::random_element();
+    }
+
+    // powers of two up to the size of the pool, and the size of the pool itself
+    const size_t pool_num_threads = get_num_threads();
+    std::vector<size_t> calibration_num_threads;
+    for (size_t num_threads = 1; num_threads < pool_num_threads; num_threads <<= 1) {
+        calibration_num_threads.push_back(num_threads);
+    }
+    calibration_num_threads.push_back(pool_num_threads);
+    scalar_multiplication::bucket_width_table table;
+    for (const size_t num_threads : calibration_num_threads) {
+        set_num_threads(num_threads);
+        for (size_t log_num_points = scalar_multiplication::MIN_CALIBRATED_LOG_POINTS;
+             log_num_points <= max_log_num_points;
+             ++log_num_points) {
+            const size_t num_points = 1UL << log_num_points;
+            const size_t num_repeats = (log_num_points < CALIBRATION_REPEAT_LOG_POINTS) ? CALIBRATION_NUM_REPEATS : 1;
+            const size_t default_width = scalar_multiplication::get_optimal_bucket_width(num_points);
+            const size_t min_width = std::max(default_width, CALIBRATION_WIDTH_RADIUS + 1) - CALIBRATION_WIDTH_RADIUS;
+            const size_t max_width = std::min({ default_width + CALIBRATION_WIDTH_RADIUS,
+                                                log_num_points,
+                                                scalar_multiplication::MAX_CALIBRATED_BUCKET_WIDTH });
+
+            size_t best_width = default_width;
+            int64_t best_time = std::numeric_limits<int64_t>::max();
+            for (size_t width = min_width; width <= max_width; ++width) {
+                auto candidate_table = table;
+                candidate_table.push_back({ num_threads, log_num_points, width });
+                scalar_multiplication::set_bucket_width_table(candidate_table);
+                scalar_multiplication::pippenger_runtime_state state(num_points);
+                for (size_t i = 0; i < num_repeats; ++i) {
+                    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+                    scalar_multiplication::pippenger_unsafe(&calibration_scalars[0], points, num_points, state);
+                    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+                    const int64_t time =
+                        std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start).count();
+                    if (time < best_time) {
+                        best_time = time;
+                        best_width = width;
+                    }
+                }
+            }
+            table.push_back({ num_threads, log_num_points, best_width });
+            std::cout << num_threads << " threads, 2^" << log_num_points << " points: bucket width " << best_width
+                      << " (default " << default_width << "), " << best_time << "us" << std::endl;
+        }
+    }
+    set_num_threads(pool_num_threads);
+    scalar_multiplication::set_bucket_width_table(table);
+
+    if (!scalar_multiplication::write_bucket_width_table(table_path, table)) {
+        std::cout << "could not write " << table_path << std::endl;
+        return 1;
+    }
+    std::cout << "wrote " << table.size() << " bucket widths to " << table_path << std::endl;
+    return 0;
+}
+
+// Counts the data TLB load misses of the calling thread between start and stop; -1 where perf events are unavailable
+class dtlb_miss_counter {
+  public:
+    dtlb_miss_counter()
+    {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    dtlb_miss_counter(const dtlb_miss_counter& other) = delete;
+    dtlb_miss_counter& operator=(const dtlb_miss_counter& other) = delete;
+    ~dtlb_miss_counter()
+    {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+#endif
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    int64_t stop()
+    {
+        int64_t count = -1;
+#ifdef __linux__
+        if (fd_ >= 0) {
+            ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+                count = -1;
+            }
+        }
+#endif
+        return count;
+    }
+
+  private:
+    int fd_ = -1;
+};
+
+constexpr size_t NUM_RANDOM_POINT_FETCHES = 1 << 22;
+
+/**
+ * Allocate the point table for 2^log_num_points points under each memory policy and measure (a) the data TLB misses and
+ * time of random point fetches from it, the access pattern of pippenger's bucket accumulation, on one thread, and (b)
+ * the time of an MSM over it.
+ **/
+int pippenger_memory_policies(const size_t log_num_points)
+{
+    const size_t num_points = 1UL << log_num_points;
+    const std::vector<std::pair<std::string, memory_policy>> policies = {
+        { "default", {} },
+        { "transparent huge pages", { HugePages::TRANSPARENT, NumaPlacement::NONE, 0 } },
+        { "2MB huge pages", { HugePages::EXPLICIT_2MB, NumaPlacement::NONE, 0 } },
+        { "1GB huge pages", { HugePages::EXPLICIT_1GB, NumaPlacement::NONE, 0 } },
+        { "interleaved", { HugePages::NONE, NumaPlacement::INTERLEAVE, 0 } },
+        { "interleaved, transparent huge pages", { HugePages::TRANSPARENT, NumaPlacement::INTERLEAVE, 0 } },
+    };
+
+    std::mt19937_64 rng(0);
+    std::uniform_int_distribution<size_t> distribution(0, 2 * num_points - 1);
+    std::vector<size_t> fetch_indices(NUM_RANDOM_POINT_FETCHES);
+    for (auto& index : fetch_indices) {
+        index = distribution(rng);
+    }
+
+    const memory_policy previous_policy = get_memory_policy(MemoryClass::POINT_TABLE);
+    dtlb_miss_counter counter;
+    for (const auto& [name, policy] : policies) {
+        set_memory_policy(MemoryClass::POINT_TABLE, policy);
+        auto* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+        memcpy(static_cast<void*>(points),
+               static_cast<void*>(get_monomial_points(num_points)),
+               2 * num_points * sizeof(g1::affine_element));
+
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point fetch_start = std::chrono::steady_clock::now();
+        counter.start();
+        for (const size_t index : fetch_indices) {
+            checksum ^= points[index].x.data[0];
+        }
+        const int64_t dtlb_misses = counter.stop();
+        std::chrono::steady_clock::time_point fetch_end = std::chrono::steady_clock::now();
+
+        auto state = scalar_multiplication::get_runtime_state_pool().checkout(num_points);
+        std::chrono::steady_clock::time_point msm_start = std::chrono::steady_clock::now();
+        g1::element result = scalar_multiplication::pippenger_unsafe(&scalars[0], points, num_points, *state);
+        std::chrono::steady_clock::time_point msm_end = std::chrono::steady_clock::now();
+
+        std::cout << name << ": " << NUM_RANDOM_POINT_FETCHES << " random fetches in "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(fetch_end - fetch_start).count() << "us, "
+                  << dtlb_misses << " dTLB misses; 2^" << log_num_points << " point MSM in "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(msm_end - msm_start).count() << "us"
+                  << std::endl;
+        std::cout << result.x << ", " << checksum << std::endl;
+        scalar_multiplication::point_table_free(points);
+    }
+    set_memory_policy(MemoryClass::POINT_TABLE, previous_policy);
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -94,8 +387,22 @@ int coset_fft_regular()
     return 0;
 }
 
-int main()
+// `pippenger_bench calibrate [max_log_num_points]` writes the bucket width table for this machine
+// `pippenger_bench memory_policies [log_num_points]` compares point table memory policies
+int main(int argc, char** argv)
 {
+    if (argc > 1 && std::string(argv[1]) == "calibrate") {
+        const size_t max_log_num_points =
+            (argc > 2) ? std::stoul(argv[2]) : scalar_multiplication::MAX_CALIBRATED_LOG_POINTS;
+        return calibrate_bucket_widths(max_log_num_points);
+    }
+    if (argc > 1 && std::string(argv[1]) == "memory_policies") {
+        const size_t log_num_points =
+            std::min((argc > 2) ? std::stoul(argv[2]) : MAX_SWEEP_LOG_POINTS, MAX_SWEEP_LOG_POINTS);
+        max_num_points = 1UL << log_num_points;
+        init();
+        return pippenger_memory_policies(log_num_points);
+    }
     std::cout << "initializing" << std::endl;
     init();
     std::cout << "executing normal fft" << std::endl;
@@ -103,10 +410,19 @@ int main()
     std::cout << "executing sliced fft" << std::endl;
     coset_fft_split();
     std::cout << "executing pippenger algorithm" << std::endl;
+    print_runtime_state_pool_stats();
     pippenger();
     pippenger();
     pippenger();
     pippenger();
     pippenger();
+    // only the first call should have allocated a runtime state
+    print_runtime_state_pool_stats();
+    std::cout << "executing fixed-base pippenger algorithm" << std::endl;
+    pippenger_fixed_base();
+    pippenger_fixed_base();
+    print_runtime_state_pool_stats();
+    std::cout << "executing bucket strategy sweep" << std::endl;
+    pippenger_bucket_strategies();
     return 0;
 }
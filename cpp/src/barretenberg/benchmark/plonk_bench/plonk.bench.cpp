@@ -3,6 +3,7 @@
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/plonk/composer/standard_composer.hpp"
 #include "barretenberg/plonk/proof_system/prover/prover.hpp"
+#include "barretenberg/plonk/proof_system/prover/prover_pool.hpp"
 #include "barretenberg/plonk/proof_system/verifier/verifier.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 
@@ -76,17 +77,34 @@ void construct_instances_bench(State& state) noexcept
 }
 BENCHMARK(construct_instances_bench)->RangeMultiplier(2)->Range(START, MAX_GATES);
 
+/**
+ * Besides the proving time, report how long the prover was blocked on the work queue in each round (the critical path
+ * of the round's MSMs and FFTs) and how much of the queue's work overlapped, averaged over the iterations.
+ */
 void construct_proofs_bench(State& state) noexcept
 {
+    std::vector<double> critical_paths;
+    double overlap = 0;
     for (auto _ : state) {
         size_t idx = static_cast<size_t>(numeric::get_msb((uint64_t)state.range(0))) -
                      static_cast<size_t>(numeric::get_msb(START));
         // provers[idx].reset();
         proofs[idx] = provers[idx].construct_proof();
         state.PauseTiming();
+        const auto& timings = provers[idx].queue.get_round_timings();
+        critical_paths.resize(timings.size(), 0);
+        for (size_t i = 0; i < timings.size(); ++i) {
+            critical_paths[i] += timings[i].critical_path;
+            overlap += timings[i].get_overlap();
+        }
         provers[idx].reset();
         state.ResumeTiming();
     }
+    for (size_t i = 0; i < critical_paths.size(); ++i) {
+        state.counters["queue_round_" + std::to_string(i) + "_ms"] =
+            Counter(critical_paths[i] * 1000, Counter::kAvgIterations);
+    }
+    state.counters["queue_overlap_ms"] = Counter(overlap * 1000, Counter::kAvgIterations);
 }
 BENCHMARK(construct_proofs_bench)->RangeMultiplier(2)->Range(START, MAX_GATES);
 
@@ -106,4 +124,76 @@ void verify_proofs_bench(State& state) noexcept
 }
 BENCHMARK(verify_proofs_bench)->RangeMultiplier(2)->Range(START, MAX_GATES);
 
+constexpr size_t NUM_POOL_PROOFS = 8;
+
+/**
+ * Prove NUM_POOL_PROOFS instances of a circuit of `state.range(0)` gates through a ProverPool, `state.range(1)` at a
+ * time, and report the throughput.
+ */
+void construct_proofs_pool_bench(State& state) noexcept
+{
+    const size_t num_gates = static_cast<size_t>(state.range(0));
+    plonk::StandardComposer composer = plonk::StandardComposer(num_gates);
+    generate_test_plonk_circuit(composer, num_gates);
+    plonk::ProverPool<plonk::Prover> pool(composer.compute_proving_key(), static_cast<size_t>(state.range(1)));
+    std::vector<plonk::Prover> pool_provers;
+    for (size_t i = 0; i < NUM_POOL_PROOFS; ++i) {
+        plonk::StandardComposer instance(pool.create_proof_key(), nullptr, num_gates);
+        generate_test_plonk_circuit(instance, num_gates);
+        pool_provers.push_back(instance.create_prover());
+    }
+    for (auto _ : state) {
+        DoNotOptimize(pool.construct_proofs(pool_provers));
+        state.PauseTiming();
+        for (auto& prover : pool_provers) {
+            prover.reset();
+        }
+        state.ResumeTiming();
+    }
+    state.counters["proofs_per_minute"] =
+        Counter(static_cast<double>(state.iterations()) * NUM_POOL_PROOFS * 60, Counter::kIsRate);
+}
+BENCHMARK(construct_proofs_pool_bench)
+    ->ArgsProduct({ { 1 << 14, 1 << 16 }, { 1, 2, 4 } })
+    ->Unit(kMillisecond)
+    ->UseRealTime();
+
+constexpr size_t BATCH_VERIFY_GATES = 1 << 12;
+constexpr size_t MAX_BATCH_VERIFY_PROOFS = 64;
+
+/**
+ * Verify `state.range(0)` proofs of one circuit, each with its own witness, with one pairing check (see
+ * VerifierBase::verify_proofs), and report the throughput. A batch of one is the cost of verify_proof.
+ */
+void verify_proofs_batch_bench(State& state) noexcept
+{
+    static std::vector<plonk::proof> batch_proofs;
+    static plonk::StandardComposer composer(BATCH_VERIFY_GATES);
+    if (batch_proofs.empty()) {
+        generate_test_plonk_circuit(composer, BATCH_VERIFY_GATES);
+        plonk::ProverPool<plonk::Prover> pool(composer.compute_proving_key(), 1);
+        std::vector<plonk::Prover> pool_provers;
+        for (size_t i = 0; i < MAX_BATCH_VERIFY_PROOFS; ++i) {
+            plonk::StandardComposer instance(pool.create_proof_key(), nullptr, BATCH_VERIFY_GATES);
+            generate_test_plonk_circuit(instance, BATCH_VERIFY_GATES);
+            pool_provers.push_back(instance.create_prover());
+        }
+        batch_proofs = pool.construct_proofs(pool_provers);
+    }
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    const std::vector<plonk::proof> batch(batch_proofs.begin(),
+                                          batch_proofs.begin() + static_cast<std::ptrdiff_t>(batch_size));
+    auto verifier = composer.create_verifier();
+    for (auto _ : state) {
+        DoNotOptimize(verifier.verify_proofs(batch));
+    }
+    state.counters["proofs_per_second"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(batch_size), Counter::kIsRate);
+}
+BENCHMARK(verify_proofs_batch_bench)
+    ->RangeMultiplier(4)
+    ->Range(1, MAX_BATCH_VERIFY_PROOFS)
+    ->Unit(kMillisecond)
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
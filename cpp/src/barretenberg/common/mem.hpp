@@ -1,8 +1,18 @@
 #pragma once
 #include "log.hpp"
 #include "memory.h"
+#include <cstdint>
+#include <fstream>
 #include <memory>
+#include <mutex>
 #include <stdlib.h>
+#include <string>
+#include <unordered_map>
+#if defined(__linux__) && !defined(__wasm__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #define pad(size, alignment) (size - (size % alignment) + ((size % alignment) == 0 ? 0 : alignment))
 
@@ -55,4 +65,212 @@ inline void aligned_free(void* mem)
 {
     _aligned_free(mem);
 }
-#endif
\ No newline at end of file
+#endif
+
+/**
+ * Allocation policies for the largest, most randomly accessed buffers in the process: pippenger point tables (which
+ * hold the SRS monomials) and the large polynomials (the 4n coset evaluations in particular).
+ *
+ * A policy can ask for huge pages, which cut the TLB misses of random fetches from a multi-GB table, and can bind the
+ * buffer to one NUMA node or interleave it across all of them. Both are requests: when the kernel cannot satisfy them
+ * (no huge pages reserved, no NUMA support) the memory is allocated with ordinary pages and the default placement.
+ *
+ * Policies are configured per buffer class with set_memory_policy, before the buffers are allocated. The default
+ * policy allocates with aligned_alloc, so its buffers can still be freed with aligned_free; a buffer allocated under
+ * any other policy must be freed with policy_aligned_free.
+ */
+enum class MemoryClass { POINT_TABLE, POLYNOMIAL, NUM_MEMORY_CLASSES };
+
+enum class HugePages {
+    NONE,
+    // madvise(MADV_HUGEPAGE): transparent 2MB pages, where the kernel can find them
+    TRANSPARENT,
+    // mmap(MAP_HUGETLB) from the reserved 2MB or 1GB page pools, falling back to TRANSPARENT
+    EXPLICIT_2MB,
+    EXPLICIT_1GB,
+};
+
+enum class NumaPlacement {
+    NONE,
+    // all pages on `numa_node`
+    BIND,
+    // pages spread round-robin across every online node
+    INTERLEAVE,
+};
+
+struct memory_policy {
+    HugePages huge_pages = HugePages::NONE;
+    NumaPlacement numa_placement = NumaPlacement::NONE;
+    size_t numa_node = 0;
+
+    bool is_default() const { return huge_pages == HugePages::NONE && numa_placement == NumaPlacement::NONE; }
+
+    // Granularity of a mapping made under this policy
+    size_t get_page_size() const
+    {
+        switch (huge_pages) {
+        case HugePages::NONE:
+            return 1UL << 12;
+        case HugePages::EXPLICIT_1GB:
+            return 1UL << 30;
+        default:
+            return 1UL << 21;
+        }
+    }
+};
+
+inline memory_policy& get_memory_policy(const MemoryClass memory_class)
+{
+    static memory_policy policies[static_cast<size_t>(MemoryClass::NUM_MEMORY_CLASSES)];
+    return policies[static_cast<size_t>(memory_class)];
+}
+
+// Bit mask of the online NUMA nodes (up to 64), read from sysfs; node 0 alone if that is not available
+inline uint64_t get_numa_node_mask()
+{
+    std::ifstream is("/sys/devices/system/node/online");
+    std::string ranges;
+    if (!(is >> ranges)) {
+        return 1;
+    }
+    uint64_t mask = 0;
+    size_t position = 0;
+    while (position < ranges.size()) {
+        size_t end = ranges.find(',', position);
+        end = (end == std::string::npos) ? ranges.size() : end;
+        const std::string range = ranges.substr(position, end - position);
+        const size_t dash = range.find('-');
+        const size_t first = std::stoul(range.substr(0, dash));
+        const size_t last = (dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1));
+        for (size_t node = first; node <= last && node < 64; ++node) {
+            mask |= 1ULL << node;
+        }
+        position = end + 1;
+    }
+    return mask == 0 ? 1 : mask;
+}
+
+// A policy that binds to a node which is not online (or beyond the 64 nodes of get_numa_node_mask) interleaves across
+// the online nodes instead
+inline void set_memory_policy(const MemoryClass memory_class, const memory_policy& policy)
+{
+    memory_policy& current = get_memory_policy(memory_class);
+    current = policy;
+    if (policy.numa_placement == NumaPlacement::BIND &&
+        (policy.numa_node >= 64 || ((get_numa_node_mask() >> policy.numa_node) & 1ULL) == 0)) {
+        info("NUMA node ", policy.numa_node, " is not online; interleaving across the online nodes instead");
+        current.numa_placement = NumaPlacement::INTERLEAVE;
+    }
+}
+
+/**
+ * Map `size` bytes (a multiple of policy.get_page_size()) of zeroed memory under the given policy. The NUMA placement
+ * is applied before the pages are first touched. Returns nullptr if nothing could be mapped.
+ */
+inline void* map_pages(const size_t size, const memory_policy& policy)
+{
+#if defined(__linux__) && !defined(__wasm__)
+    void* pages = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (policy.huge_pages == HugePages::EXPLICIT_2MB || policy.huge_pages == HugePages::EXPLICIT_1GB) {
+        const int page_size_flag = (policy.huge_pages == HugePages::EXPLICIT_1GB) ? (30 << 26) : (21 << 26);
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_size_flag;
+        pages = mmap(0, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    }
+#endif
+    if (pages == MAP_FAILED) {
+        pages = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pages == MAP_FAILED) {
+            return nullptr;
+        }
+#ifdef MADV_HUGEPAGE
+        if (policy.huge_pages != HugePages::NONE) {
+            madvise(pages, size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+#ifdef SYS_mbind
+    if (policy.numa_placement != NumaPlacement::NONE) {
+        // a policy modified through get_memory_policy can still name a node the mask cannot hold; interleave then
+        const bool bind = policy.numa_placement == NumaPlacement::BIND && policy.numa_node < 64;
+        // MPOL_BIND and MPOL_INTERLEAVE, from <numaif.h>
+        const int mode = bind ? 2 : 3;
+        const uint64_t node_mask = bind ? (1ULL << policy.numa_node) : get_numa_node_mask();
+        syscall(SYS_mbind, pages, size, mode, &node_mask, 8 * sizeof(node_mask) + 1, 0);
+    }
+#endif
+    return pages;
+#else
+    (void)policy;
+    void* pages = aligned_alloc(64, size);
+    memset(pages, 0, size);
+    return pages;
+#endif
+}
+
+inline void unmap_pages(void* pages, const size_t size)
+{
+#if defined(__linux__) && !defined(__wasm__)
+    munmap(pages, size);
+#else
+    (void)size;
+    aligned_free(pages);
+#endif
+}
+
+// The buffers policy_aligned_alloc mapped with map_pages, and the size of each mapping
+struct mapped_buffer_registry {
+    std::mutex mutex;
+    std::unordered_map<void*, size_t> mapped_sizes;
+};
+
+inline mapped_buffer_registry& get_mapped_buffer_registry()
+{
+    static mapped_buffer_registry registry;
+    return registry;
+}
+
+/**
+ * aligned_alloc under the policy of a buffer class. With the default policy this is aligned_alloc, and the buffer may
+ * be returned with either aligned_free or policy_aligned_free. Otherwise the buffer is mapped with map_pages (falling
+ * back to aligned_alloc if that fails) and must be returned with policy_aligned_free.
+ */
+inline void* policy_aligned_alloc(const MemoryClass memory_class, const size_t alignment, const size_t size)
+{
+    const memory_policy& policy = get_memory_policy(memory_class);
+    if (!policy.is_default()) {
+        // Mappings are page aligned, which covers any alignment we ask for
+        const size_t page_size = policy.get_page_size();
+        const size_t mapped_size = ((size + page_size - 1) / page_size) * page_size;
+        void* buffer = map_pages(mapped_size, policy);
+        if (buffer != nullptr) {
+            auto& registry = get_mapped_buffer_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.mapped_sizes[buffer] = mapped_size;
+            return buffer;
+        }
+    }
+    return aligned_alloc(alignment, size);
+}
+
+inline void policy_aligned_free(void* buffer)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    size_t mapped_size = 0;
+    {
+        auto& registry = get_mapped_buffer_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto it = registry.mapped_sizes.find(buffer);
+        if (it != registry.mapped_sizes.end()) {
+            mapped_size = it->second;
+            registry.mapped_sizes.erase(it);
+        }
+    }
+    if (mapped_size != 0) {
+        unmap_pages(buffer, mapped_size);
+    } else {
+        aligned_free(buffer);
+    }
+}
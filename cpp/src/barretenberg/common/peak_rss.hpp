@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+#include <sys/resource.h>
+
+/**
+ * @brief The peak resident set size of the process so far, in kB. Used by the benchmarks to report memory use.
+ */
+inline size_t get_peak_rss()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);
+}
@@ -0,0 +1,343 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <omp.h>
+#endif
+
+namespace barretenberg {
+
+#ifndef NO_MULTITHREADING
+/**
+ * A work-stealing thread pool.
+ *
+ * `parallel_for` splits its range in halves, recursively: a thread keeps the left half and pushes the right half onto
+ * its own queue, until a range is no larger than the grain size. Idle threads steal the largest pending ranges from the
+ * fronts of other threads' queues, so uneven work (sparse rows, skipped rounds) is balanced without any up-front
+ * partition, and the number of threads need not be a power of two. A thread that waits for its ranges to complete
+ * executes pending ranges meanwhile, so a `parallel_for` may be nested in another one.
+ *
+ * The calling thread takes part in the work: a pool of n threads starts n - 1 workers. Calling threads that are not
+ * workers (e.g. several provers sharing the pool) each push onto one of a set of external queues, so that their ranges
+ * are not interleaved on one queue. The functions run by the pool must not throw.
+ */
+class ThreadPool {
+  public:
+    explicit ThreadPool(const size_t num_threads)
+        : num_threads_(std::max(num_threads, 1UL))
+        , queues_(num_threads_ - 1 + NUM_EXTERNAL_QUEUES)
+    {
+        for (size_t i = 0; i + 1 < num_threads_; ++i) {
+            workers_.emplace_back([this, i]() { run_worker(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_condition_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    size_t get_num_threads() const { return num_threads_; }
+
+    /**
+     * Call `func(start, end)` on disjoint ranges that together cover [0, num_iterations), and return once all have
+     * completed. Every range starts at a multiple of `grain_size` and, except the last, is a multiple of it long. The
+     * ranges are made longer than `grain_size` (by a whole multiple) where that still gives every thread a few of them.
+     */
+    template <typename Func> void parallel_for(const size_t num_iterations, const Func& func, size_t grain_size = 1)
+    {
+        if (num_iterations == 0) {
+            return;
+        }
+        grain_size = std::max(grain_size, 1UL);
+        const size_t num_grains = (num_iterations + grain_size - 1) / grain_size;
+        const size_t target_num_ranges = RANGES_PER_THREAD * num_threads_;
+        grain_size *= (num_grains + target_num_ranges - 1) / target_num_ranges;
+        if (num_iterations <= grain_size || num_threads_ == 1) {
+            func(0, num_iterations);
+            return;
+        }
+        std::atomic<size_t> pending = 1;
+        execute({ &run_range<Func>, &func, 0, num_iterations, grain_size, &pending });
+        wait(pending);
+    }
+
+  private:
+    // Enough ranges that a thread which finishes early finds others to steal
+    static constexpr size_t RANGES_PER_THREAD = 4;
+    // Calling threads beyond this many share queues
+    static constexpr size_t NUM_EXTERNAL_QUEUES = 16;
+    // A waiting thread yields this many times without finding a task before it sleeps
+    static constexpr size_t NUM_SPINS_BEFORE_SLEEP = 1024;
+
+    struct task {
+        void (*run)(const void* func, size_t start, size_t end);
+        const void* func;
+        size_t start;
+        size_t end;
+        size_t grain_size;
+        std::atomic<size_t>* pending;
+    };
+
+    struct task_queue {
+        std::mutex mutex;
+        std::deque<task> tasks;
+        // lets `pop` skip empty queues without taking their locks
+        std::atomic<size_t> num_tasks = 0;
+    };
+
+    template <typename Func> static void run_range(const void* func, const size_t start, const size_t end)
+    {
+        (*static_cast<const Func*>(func))(start, end);
+    }
+
+    // The queue of the calling thread. Queues [0, num_threads_ - 1) belong to the workers, the rest are external
+    size_t get_queue_index() const
+    {
+        return (current_pool() == this) ? current_queue_index()
+                                        : num_threads_ - 1 + (external_queue_slot() % NUM_EXTERNAL_QUEUES);
+    }
+
+    static const ThreadPool*& current_pool()
+    {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& current_queue_index()
+    {
+        thread_local size_t index = 0;
+        return index;
+    }
+
+    // Assigned to each calling thread in turn, the first time it calls into a pool
+    static size_t external_queue_slot()
+    {
+        static std::atomic<size_t> next_slot = 0;
+        thread_local const size_t slot = next_slot.fetch_add(1);
+        return slot;
+    }
+
+    void push(const task& t)
+    {
+        task_queue& queue = queues_[get_queue_index()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(t);
+            queue.num_tasks.fetch_add(1);
+        }
+        num_queued_.fetch_add(1);
+        if (num_sleeping_.load() > 0) {
+            // taking the lock orders this notification after a sleeper's check of num_queued_
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            sleep_condition_.notify_one();
+        }
+    }
+
+    // Our own most recently pushed task (the smallest, and the one whose data is warmest), else the oldest task of
+    // another thread (the largest)
+    bool pop(task& t)
+    {
+        if (num_queued_.load() == 0) {
+            return false;
+        }
+        const size_t own_index = get_queue_index();
+        for (size_t i = 0; i < queues_.size(); ++i) {
+            task_queue& queue = queues_[(own_index + i) % queues_.size()];
+            if (queue.num_tasks.load() == 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            queue.num_tasks.fetch_sub(1);
+            if (i == 0) {
+                t = queue.tasks.back();
+                queue.tasks.pop_back();
+            } else {
+                t = queue.tasks.front();
+                queue.tasks.pop_front();
+            }
+            num_queued_.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+
+    void execute(task t)
+    {
+        while (t.end - t.start > t.grain_size) {
+            const size_t num_grains = (t.end - t.start + t.grain_size - 1) / t.grain_size;
+            const size_t middle = t.start + (num_grains / 2) * t.grain_size;
+            t.pending->fetch_add(1);
+            push({ t.run, t.func, middle, t.end, t.grain_size, t.pending });
+            t.end = middle;
+        }
+        t.run(t.func, t.start, t.end);
+        // the last range of a loop wakes its caller, should it be asleep in `wait`. `pending` may be gone once it is 0
+        if (t.pending->fetch_sub(1) == 1) {
+            wake_sleepers();
+        }
+    }
+
+    // Execute pending tasks (of any loop) until our loop's ranges have all completed, sleeping if there are none
+    void wait(const std::atomic<size_t>& pending)
+    {
+        size_t num_spins = 0;
+        task t;
+        while (pending.load() != 0) {
+            if (pop(t)) {
+                execute(t);
+                num_spins = 0;
+                continue;
+            }
+            if (++num_spins < NUM_SPINS_BEFORE_SLEEP) {
+                std::this_thread::yield();
+                continue;
+            }
+            num_spins = 0;
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            num_sleeping_.fetch_add(1);
+            sleep_condition_.wait(lock, [&]() { return pending.load() == 0 || num_queued_.load() > 0; });
+            num_sleeping_.fetch_sub(1);
+        }
+    }
+
+    void wake_sleepers()
+    {
+        if (num_sleeping_.load() > 0) {
+            // taking the lock orders this notification after a sleeper's check of its condition
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            sleep_condition_.notify_all();
+        }
+    }
+
+    void run_worker(const size_t index)
+    {
+        current_pool() = this;
+        current_queue_index() = index;
+        size_t num_spins = 0;
+        task t;
+        while (true) {
+            if (pop(t)) {
+                execute(t);
+                num_spins = 0;
+                continue;
+            }
+            if (++num_spins < NUM_SPINS_BEFORE_SLEEP) {
+                std::this_thread::yield();
+                continue;
+            }
+            num_spins = 0;
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            num_sleeping_.fetch_add(1);
+            sleep_condition_.wait(lock, [this]() { return stop_ || num_queued_.load() > 0; });
+            num_sleeping_.fetch_sub(1);
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    const size_t num_threads_;
+    std::vector<task_queue> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> num_queued_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    bool stop_ = false;
+};
+
+namespace thread_pool_detail {
+inline std::unique_ptr<ThreadPool>& get_thread_pool_instance()
+{
+    // OMP_NUM_THREADS, if set, sizes the pool as it does OpenMP's
+    static std::unique_ptr<ThreadPool> pool =
+        std::make_unique<ThreadPool>(static_cast<size_t>(std::max(omp_get_max_threads(), 1)));
+    return pool;
+}
+} // namespace thread_pool_detail
+
+// The pool that every parallel loop of the library runs on
+inline ThreadPool& get_thread_pool()
+{
+    return *thread_pool_detail::get_thread_pool_instance();
+}
+
+inline size_t get_num_threads()
+{
+    return get_thread_pool().get_num_threads();
+}
+
+/**
+ * Replace the process-wide pool with one of `num_threads` threads (any number, not only powers of two). Must not be
+ * called while any parallel loop is running.
+ */
+inline void set_num_threads(const size_t num_threads)
+{
+    auto& pool = thread_pool_detail::get_thread_pool_instance();
+    pool.reset();
+    pool = std::make_unique<ThreadPool>(num_threads);
+}
+
+/**
+ * Call `func(start, end)` on ranges covering [0, num_iterations) in parallel; see ThreadPool::parallel_for.
+ */
+template <typename Func>
+inline void parallel_for(const size_t num_iterations, const Func& func, const size_t grain_size = 1)
+{
+    get_thread_pool().parallel_for(num_iterations, func, grain_size);
+}
+#else
+inline size_t get_num_threads()
+{
+    return 1;
+}
+
+inline void set_num_threads(const size_t) {}
+
+template <typename Func> inline void parallel_for(const size_t num_iterations, const Func& func, const size_t = 1)
+{
+    if (num_iterations > 0) {
+        func(0, num_iterations);
+    }
+}
+#endif
+
+/**
+ * Run `tasks` in parallel, and return once all have completed.
+ */
+inline void fork_join(const std::vector<std::function<void()>>& tasks)
+{
+    parallel_for(
+        tasks.size(),
+        [&](const size_t start, const size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                tasks[i]();
+            }
+        },
+        1);
+}
+
+} // namespace barretenberg
@@ -19,7 +19,6 @@ constexpr size_t size_of_generator_data_array = hash_indices_generator_offset +
 constexpr size_t num_generator_types = 3;
 
 ladder_t g1_ladder;
-bool inited = false;
 
 void compute_fixed_base_ladder(const grumpkin::g1::affine_element& generator, ladder_t& ladder)
 {
@@ -200,29 +199,27 @@ const fixed_base_ladder* get_ladder_internal(std::array<fixed_base_ladder, quad_
  **/
 std::vector<std::unique_ptr<generator_data>> const& init_generator_data()
 {
-    static std::vector<std::unique_ptr<generator_data>> global_generator_data;
-    if (inited) {
-        return global_generator_data;
-    }
-    std::vector<grumpkin::g1::affine_element> generators;
-    std::vector<grumpkin::g1::affine_element> aux_generators;
-    std::vector<grumpkin::g1::affine_element> skew_generators;
-    std::tie(generators, aux_generators, skew_generators) =
-        derive_generators<size_of_generator_data_array * num_generator_types>();
-
-    global_generator_data.resize(size_of_generator_data_array);
-
-    for (size_t i = 0; i < num_default_generators; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
-    }
-
-    for (size_t i = hash_indices_generator_offset; i < size_of_generator_data_array; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
-    }
+    // a function-local static, so concurrent first callers wait for a single derivation
+    static const std::vector<std::unique_ptr<generator_data>> global_generator_data = []() {
+        std::vector<grumpkin::g1::affine_element> generators;
+        std::vector<grumpkin::g1::affine_element> aux_generators;
+        std::vector<grumpkin::g1::affine_element> skew_generators;
+        std::tie(generators, aux_generators, skew_generators) =
+            derive_generators<size_of_generator_data_array * num_generator_types>();
+
+        std::vector<std::unique_ptr<generator_data>> data(size_of_generator_data_array);
+
+        for (size_t i = 0; i < num_default_generators; i++) {
+            data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        }
 
-    compute_fixed_base_ladder(grumpkin::g1::one, g1_ladder);
+        for (size_t i = hash_indices_generator_offset; i < size_of_generator_data_array; i++) {
+            data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        }
 
-    inited = true;
+        compute_fixed_base_ladder(grumpkin::g1::one, g1_ladder);
+        return data;
+    }();
     return global_generator_data;
 };
 
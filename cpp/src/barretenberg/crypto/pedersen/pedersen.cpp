@@ -1,10 +1,8 @@
 #include "./pedersen.hpp"
 #include "./convert_buffer_to_field.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
 
 namespace crypto {
 namespace pedersen {
@@ -52,12 +50,13 @@ grumpkin::g1::affine_element commit_native(const std::vector<grumpkin::fq>& inpu
 #ifndef NO_MULTITHREADING
     // Ensure generator data is initialized before threading...
     init_generator_data();
-#pragma omp parallel for num_threads(inputs.size())
 #endif
-    for (size_t i = 0; i < inputs.size(); ++i) {
-        generator_index_t index = { hash_index, i };
-        out[i] = hash_single(inputs[i], index);
-    }
+    barretenberg::parallel_for(inputs.size(), [&](const size_t start, const size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            generator_index_t index = { hash_index, i };
+            out[i] = hash_single(inputs[i], index);
+        }
+    });
 
     grumpkin::g1::element r = out[0];
     for (size_t i = 1; i < inputs.size(); ++i) {
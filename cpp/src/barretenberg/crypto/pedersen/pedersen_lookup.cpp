@@ -11,7 +11,6 @@ namespace {
 static std::array<std::vector<grumpkin::g1::affine_element>, NUM_PEDERSEN_TABLES> pedersen_tables;
 static std::vector<grumpkin::g1::affine_element> pedersen_iv_table;
 static std::array<grumpkin::g1::affine_element, NUM_PEDERSEN_TABLES> generators;
-static bool inited = false;
 
 void init_single_lookup_table(const size_t index)
 {
@@ -67,21 +66,22 @@ void init()
 {
     ASSERT(BITS_PER_TABLE < BITS_OF_BETA);
     ASSERT(BITS_PER_TABLE + BITS_OF_BETA < BITS_ON_CURVE);
-    if (inited) {
-        return;
-    }
-    generators = grumpkin::g1::derive_generators<NUM_PEDERSEN_TABLES>();
-    const size_t first_half = (NUM_PEDERSEN_TABLES >> 1) - 1;
-    for (size_t i = 0; i < first_half; ++i) {
-        init_single_lookup_table(i);
-    }
-    init_small_lookup_table(first_half);
-    for (size_t i = 0; i < first_half; ++i) {
-        init_single_lookup_table(i + first_half + 1);
-    }
-    init_small_lookup_table(2 * first_half + 1);
-    init_iv_lookup_table();
-    inited = true;
+    // the tables are filled once; a thread that calls init() meanwhile blocks until they are complete
+    static const bool inited = []() {
+        generators = grumpkin::g1::derive_generators<NUM_PEDERSEN_TABLES>();
+        const size_t first_half = (NUM_PEDERSEN_TABLES >> 1) - 1;
+        for (size_t i = 0; i < first_half; ++i) {
+            init_single_lookup_table(i);
+        }
+        init_small_lookup_table(first_half);
+        for (size_t i = 0; i < first_half; ++i) {
+            init_single_lookup_table(i + first_half + 1);
+        }
+        init_small_lookup_table(2 * first_half + 1);
+        init_iv_lookup_table();
+        return true;
+    }();
+    static_cast<void>(inited);
 }
 } // namespace
 
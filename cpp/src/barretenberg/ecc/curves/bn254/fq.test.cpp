@@ -498,4 +498,23 @@ TEST(fq, neg_and_self_neg_0_cmp_regression)
     a_neg = 0;
     a_neg.self_neg();
     EXPECT_EQ((a == a_neg), true);
-}
\ No newline at end of file
+}
+
+TEST(fq, batch_arithmetic)
+{
+    constexpr size_t n = 67;
+    std::vector<fq> a(n);
+    std::vector<fq> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fq::random_element();
+        b[i] = fq::random_element();
+    }
+    std::vector<fq> products(n);
+    std::vector<fq> squares(n);
+    fq::mul_batch(a.data(), b.data(), products.data(), n);
+    fq::sqr_batch(a.data(), squares.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], a[i] * b[i]);
+        EXPECT_EQ(squares[i], a[i].sqr());
+    }
+}
@@ -435,4 +435,88 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+// Element-wise arithmetic over arrays that fit in L2: loops over the scalar operators against the array methods, which
+// are vectorised on CPUs with AVX-512 IFMA
+constexpr size_t NUM_BATCH_ELEMENTS = 1 << 14;
+constexpr size_t NUM_BATCH_INVERSIONS = 1 << 16;
+std::vector<fr> batch_output(NUM_BATCH_INVERSIONS);
+
+void mul_loop_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BATCH_ELEMENTS; ++i) {
+            batch_output[i] = oldx[i] * oldy[i];
+        }
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(mul_loop_bench);
+
+void mul_batch_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        fr::mul_batch(oldx.data(), oldy.data(), batch_output.data(), NUM_BATCH_ELEMENTS);
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(mul_batch_bench);
+
+void sqr_loop_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BATCH_ELEMENTS; ++i) {
+            batch_output[i] = oldx[i].sqr();
+        }
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(sqr_loop_bench);
+
+void sqr_batch_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        fr::sqr_batch(oldx.data(), batch_output.data(), NUM_BATCH_ELEMENTS);
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(sqr_batch_bench);
+
+void add_loop_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BATCH_ELEMENTS; ++i) {
+            batch_output[i] = oldx[i] + oldy[i];
+        }
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(add_loop_bench);
+
+void add_batch_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        fr::add_batch(oldx.data(), oldy.data(), batch_output.data(), NUM_BATCH_ELEMENTS);
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(add_batch_bench);
+
+void batch_invert_bench(State& state) noexcept
+{
+    std::copy(oldx.begin(), oldx.begin() + NUM_BATCH_INVERSIONS, batch_output.begin());
+    for (auto _ : state) {
+        // inverting the inverses is as good a workload as any
+        fr::batch_invert(batch_output.data(), NUM_BATCH_INVERSIONS);
+        DoNotOptimize(batch_output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_INVERSIONS));
+}
+BENCHMARK(batch_invert_bench);
+
 BENCHMARK_MAIN();
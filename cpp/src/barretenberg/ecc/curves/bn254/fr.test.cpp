@@ -324,6 +324,80 @@ TEST(fr, batch_invert)
     }
 }
 
+TEST(fr, batch_invert_large)
+{
+    // large enough for the interleaved path, not a multiple of its row width, and with zeroes to skip
+    constexpr size_t n = 1000;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 97 == 3) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses(coeffs);
+    fr::batch_invert(inverses.data(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_EQ(inverses[i], fr::zero());
+        } else {
+            EXPECT_EQ(inverses[i], coeffs[i].invert());
+        }
+    }
+}
+
+TEST(fr, batch_arithmetic)
+{
+    // odd size, so that the vectorised kernels leave a tail to the scalar code
+    constexpr size_t n = 203;
+    std::vector<fr> a(n);
+    std::vector<fr> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fr::random_element();
+        b[i] = fr::random_element();
+    }
+    // edge cases of the coarse [0, 2p) representation
+    const uint256_t twice_modulus = fr::modulus + fr::modulus;
+    const fr largest{ twice_modulus.data[0] - 1, twice_modulus.data[1], twice_modulus.data[2], twice_modulus.data[3] };
+    const fr modulus{ fr::modulus.data[0], fr::modulus.data[1], fr::modulus.data[2], fr::modulus.data[3] };
+    a[0] = fr::zero();
+    a[1] = largest;
+    b[1] = largest;
+    a[2] = modulus;
+    a[3] = -fr::one();
+    b[3] = -fr::one();
+    const fr scalar = fr::random_element();
+
+    std::vector<fr> products(n);
+    std::vector<fr> scaled(n);
+    std::vector<fr> squares(n);
+    std::vector<fr> sums(n);
+    std::vector<fr> differences(n);
+    fr::mul_batch(a.data(), b.data(), products.data(), n);
+    fr::mul_batch(a.data(), scalar, scaled.data(), n);
+    fr::sqr_batch(a.data(), squares.data(), n);
+    fr::add_batch(a.data(), b.data(), sums.data(), n);
+    fr::sub_batch(a.data(), b.data(), differences.data(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], a[i] * b[i]);
+        EXPECT_EQ(scaled[i], a[i] * scalar);
+        EXPECT_EQ(squares[i], a[i].sqr());
+        EXPECT_EQ(sums[i], a[i] + b[i]);
+        EXPECT_EQ(differences[i], a[i] - b[i]);
+        // results must stay in the coarse range, like those of the scalar operators
+        EXPECT_LT(uint256_t(products[i].data[0], products[i].data[1], products[i].data[2], products[i].data[3]),
+                  twice_modulus);
+        EXPECT_LT(uint256_t(squares[i].data[0], squares[i].data[1], squares[i].data[2], squares[i].data[3]),
+                  twice_modulus);
+    }
+
+    // in-place
+    std::vector<fr> in_place(a);
+    fr::mul_batch(in_place.data(), b.data(), in_place.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(in_place[i], products[i]);
+    }
+}
+
 TEST(fr, multiplicative_generator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
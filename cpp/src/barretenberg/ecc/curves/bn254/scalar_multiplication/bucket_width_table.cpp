@@ -0,0 +1,131 @@
+#include "./bucket_width_table.hpp"
+#include "./runtime_states.hpp"
+
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+// Lookups take a reference to the current table, so a table that is replaced stays alive until they are done with it
+struct shared_bucket_width_table {
+    shared_bucket_width_table()
+    {
+        const char* path = std::getenv(BUCKET_WIDTH_TABLE_ENV_VAR);
+        table = std::make_shared<const bucket_width_table>(path != nullptr ? read_bucket_width_table(path)
+                                                                           : bucket_width_table());
+    }
+
+    std::mutex mutex;
+    std::shared_ptr<const bucket_width_table> table;
+};
+
+shared_bucket_width_table& get_shared_bucket_width_table()
+{
+    static shared_bucket_width_table shared_table;
+    return shared_table;
+}
+
+std::shared_ptr<const bucket_width_table> load_bucket_width_table()
+{
+    auto& shared_table = get_shared_bucket_width_table();
+    std::lock_guard<std::mutex> lock(shared_table.mutex);
+    return shared_table.table;
+}
+} // namespace
+
+bucket_width_table read_bucket_width_table(const std::string& path)
+{
+    bucket_width_table table;
+    std::ifstream is(path);
+    std::string line;
+    while (std::getline(is, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream entry(line);
+        bucket_width_calibration calibration;
+        if (!(entry >> calibration.num_threads >> calibration.log_num_points >> calibration.bucket_width)) {
+            continue;
+        }
+        if (calibration.num_threads == 0 || calibration.bucket_width == 0 ||
+            calibration.bucket_width > MAX_CALIBRATED_BUCKET_WIDTH) {
+            continue;
+        }
+        table.push_back(calibration);
+    }
+    return table;
+}
+
+bool write_bucket_width_table(const std::string& path, const bucket_width_table& table)
+{
+    std::ofstream os(path);
+    os << "# pippenger bucket widths, one <num_threads> <log_num_points> <bucket_width> entry per line\n";
+    for (const auto& calibration : table) {
+        os << calibration.num_threads << " " << calibration.log_num_points << " " << calibration.bucket_width << "\n";
+    }
+    return static_cast<bool>(os);
+}
+
+bucket_width_table get_bucket_width_table()
+{
+    return *load_bucket_width_table();
+}
+
+void set_bucket_width_table(const bucket_width_table& table)
+{
+    auto replacement = std::make_shared<const bucket_width_table>(table);
+    auto& shared_table = get_shared_bucket_width_table();
+    std::lock_guard<std::mutex> lock(shared_table.mutex);
+    shared_table.table.swap(replacement);
+}
+
+size_t get_calibrated_bucket_width(const size_t num_points)
+{
+    const std::shared_ptr<const bucket_width_table> shared_table = load_bucket_width_table();
+    const bucket_width_table& table = *shared_table;
+    if (table.empty() || num_points == 0) {
+        return get_optimal_bucket_width(num_points);
+    }
+    const size_t log_num_points = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_points)));
+    const size_t num_threads = get_num_threads();
+
+    // use the measurement for the largest thread count that does not exceed ours, or failing that the smallest one
+    const bucket_width_calibration* match = nullptr;
+    for (const auto& calibration : table) {
+        if (calibration.log_num_points != log_num_points) {
+            continue;
+        }
+        if (match == nullptr) {
+            match = &calibration;
+            continue;
+        }
+        const bool fits = calibration.num_threads <= num_threads;
+        const bool match_fits = match->num_threads <= num_threads;
+        if ((fits && (!match_fits || calibration.num_threads > match->num_threads)) ||
+            (!fits && !match_fits && calibration.num_threads < match->num_threads)) {
+            match = &calibration;
+        }
+    }
+    if (match == nullptr) {
+        return get_optimal_bucket_width(num_points);
+    }
+    // never use more buckets than there are points
+    return std::min(match->bucket_width, std::max(log_num_points, 1UL));
+}
+
+size_t get_calibrated_num_rounds(const size_t num_points)
+{
+    return WNAF_SIZE(get_calibrated_bucket_width(num_points / 2) + 1);
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+// environment variable naming the calibration file. Without it no file is read, so that the widths in use never depend
+// on the working directory of the process
+constexpr const char* BUCKET_WIDTH_TABLE_ENV_VAR = "BARRETENBERG_PIPPENGER_CALIBRATION";
+
+// calibration covers MSMs of 2^MIN_CALIBRATED_LOG_POINTS to 2^MAX_CALIBRATED_LOG_POINTS points
+constexpr size_t MIN_CALIBRATED_LOG_POINTS = 10;
+constexpr size_t MAX_CALIBRATED_LOG_POINTS = 24;
+// wider windows than this are never worth their bucket memory
+constexpr size_t MAX_CALIBRATED_BUCKET_WIDTH = 24;
+
+struct bucket_width_calibration {
+    // number of threads (see `get_num_threads`) the width was measured with
+    size_t num_threads;
+    // log2 of the number of points of the MSM, before the endomorphism split
+    size_t log_num_points;
+    size_t bucket_width;
+};
+
+/**
+ * Pippenger bucket widths measured on this machine, produced by the `calibrate` mode of pippenger_bench.
+ *
+ * `get_optimal_bucket_width` is a fixed function of the number of points. The best width also depends on the number of
+ * threads (each thread concatenates its own buckets) and on the cache sizes, so it shifts between CPU generations.
+ * MSMs whose size and thread count have no measurement use `get_optimal_bucket_width`.
+ *
+ * On disk, the table is a text file with one `<num_threads> <log_num_points> <bucket_width>` entry per line. Lines
+ * starting with '#' are comments.
+ **/
+using bucket_width_table = std::vector<bucket_width_calibration>;
+
+// returns an empty table if `path` cannot be read. Malformed entries are skipped
+bucket_width_table read_bucket_width_table(const std::string& path);
+
+bool write_bucket_width_table(const std::string& path, const bucket_width_table& table);
+
+// a copy of the process-wide table, read from the file named by `BUCKET_WIDTH_TABLE_ENV_VAR` on first use
+bucket_width_table get_bucket_width_table();
+
+/**
+ * Replace the process-wide table (for calibration runs and tests).
+ *
+ * The table is swapped atomically: a concurrent lookup sees either the old or the new table, never a partial one.
+ * One MSM looks its width up more than once, though, so the table must only be replaced while no MSM is running (at
+ * startup, or between the runs of a calibration). A runtime state records the widths it was sized for, so states
+ * constructed beforehand stay safe to use; the state pool discards those that are too small for the new widths.
+ **/
+void set_bucket_width_table(const bucket_width_table& table);
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
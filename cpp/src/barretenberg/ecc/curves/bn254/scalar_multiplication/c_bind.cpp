@@ -32,7 +32,6 @@ WASM_EXPORT void delete_pippenger(void* pippenger)
 
 WASM_EXPORT void pippenger_unsafe(void* pippenger_ptr, void* scalars_ptr, size_t from, size_t range, void* result_ptr)
 {
-    scalar_multiplication::pippenger_runtime_state state(range);
     auto pippenger = reinterpret_cast<scalar_multiplication::Pippenger*>(pippenger_ptr);
     auto scalars = reinterpret_cast<fr*>(scalars_ptr);
     auto result = reinterpret_cast<g1::element*>(result_ptr);
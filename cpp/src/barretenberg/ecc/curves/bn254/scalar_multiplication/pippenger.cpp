@@ -1,11 +1,14 @@
 #include "pippenger.hpp"
+#include "runtime_state_pool.hpp"
 #include "barretenberg/srs/io.hpp"
 namespace barretenberg {
 namespace scalar_multiplication {
 
 Pippenger::Pippenger(g1::affine_element* points, size_t num_points)
     : monomials_(points)
+    , point_table_storage_(PointTableStorage::CALLER)
     , num_points_(num_points)
+    , fixed_base_table_{ nullptr, num_points, 1, 0 }
 {
     io::byteswap(&monomials_[0], num_points * 64);
     scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
@@ -13,6 +16,7 @@ Pippenger::Pippenger(g1::affine_element* points, size_t num_points)
 
 Pippenger::Pippenger(uint8_t const* points, size_t num_points)
     : num_points_(num_points)
+    , fixed_base_table_{ nullptr, num_points, 1, 0 }
 {
     monomials_ = point_table_alloc<g1::affine_element>(num_points);
 
@@ -20,24 +24,82 @@ Pippenger::Pippenger(uint8_t const* points, size_t num_points)
     barretenberg::scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
 }
 
-Pippenger::Pippenger(std::string const& path, size_t num_points)
+Pippenger::Pippenger(std::string const& path, size_t num_points, std::string const& point_table_cache_dir)
     : num_points_(num_points)
+    , fixed_base_table_{ nullptr, num_points, 1, 0 }
 {
+    const std::string cache_path = get_point_table_cache_path(point_table_cache_dir, path);
+    if (!cache_path.empty()) {
+        mapped_point_table_ = map_point_table_cache(cache_path, num_points);
+        if (mapped_point_table_.points) {
+            monomials_ = mapped_point_table_.points;
+            point_table_storage_ = PointTableStorage::MAPPED;
+            return;
+        }
+    }
+
     monomials_ = point_table_alloc<g1::affine_element>(num_points);
 
     barretenberg::io::read_transcript_g1(monomials_, num_points, path);
     barretenberg::scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
+
+    // Swap our private table for the mapping of the cache just written, so that its pages are shared too
+    if (!cache_path.empty() && write_point_table_cache(cache_path, monomials_, num_points)) {
+        mapped_point_table_ = map_point_table_cache(cache_path, num_points);
+        if (mapped_point_table_.points) {
+            point_table_free(monomials_);
+            monomials_ = mapped_point_table_.points;
+            point_table_storage_ = PointTableStorage::MAPPED;
+        }
+    }
+}
+
+bool Pippenger::enable_fixed_base(size_t memory_budget)
+{
+    const size_t num_shifts = scalar_multiplication::get_fixed_base_num_shifts(num_points_, memory_budget);
+    // point indices (including the offset to their shifted copy) must fit in the upper 32 bits of a schedule entry
+    if (num_shifts < 2 || num_points_ * 2 * num_shifts > 0xffffffffULL) {
+        return false;
+    }
+    if (fixed_base_table_.points) {
+        point_table_free(fixed_base_table_.points);
+    }
+    const size_t table_size = get_fixed_base_table_size(num_points_, num_shifts);
+    fixed_base_table_.points = (g1::affine_element*)policy_aligned_alloc(
+        MemoryClass::POINT_TABLE, 64, table_size * sizeof(g1::affine_element));
+    fixed_base_table_.num_shifts = num_shifts;
+    fixed_base_table_.bits_per_bucket = get_calibrated_bucket_width(num_points_);
+    generate_fixed_base_point_table(monomials_, fixed_base_table_);
+    return true;
 }
 
 g1::element Pippenger::pippenger_unsafe(fr* scalars, size_t from, size_t range)
 {
-    scalar_multiplication::pippenger_runtime_state state(range);
-    return scalar_multiplication::pippenger_unsafe(scalars, monomials_ + from * 2, range, state);
+    // The shifted copies are only valid for the bucket width the table was built with. Smaller MSMs, whose optimal
+    // width is narrower, are better served by the regular algorithm.
+    if (fixed_base_table_.points && get_calibrated_bucket_width(range) == fixed_base_table_.bits_per_bucket) {
+        auto state = get_runtime_state_pool().checkout(num_points_, fixed_base_table_.num_shifts);
+        return pippenger_fixed_base_unsafe(scalars, fixed_base_table_, from, range, *state);
+    }
+    return get_runtime_state_pool().pippenger_unsafe(scalars, monomials_ + from * 2, range);
 }
 
 Pippenger::~Pippenger()
 {
-    free(monomials_);
+    switch (point_table_storage_) {
+    case PointTableStorage::CALLER:
+        aligned_free(monomials_);
+        break;
+    case PointTableStorage::ALLOCATED:
+        point_table_free(monomials_);
+        break;
+    case PointTableStorage::MAPPED:
+        unmap_point_table_cache(mapped_point_table_);
+        break;
+    }
+    if (fixed_base_table_.points) {
+        point_table_free(fixed_base_table_.points);
+    }
 }
 
 } // namespace scalar_multiplication
@@ -1,7 +1,8 @@
 #pragma once
+#include "./point_table_cache.hpp"
 #include "./scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 #ifndef NO_MULTITHREADING
 #include <omp.h>
@@ -12,12 +13,7 @@ namespace scalar_multiplication {
 
 inline size_t point_table_size(size_t num_points)
 {
-#ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
-    const size_t prefetch_overflow = 16 * num_threads;
+    const size_t prefetch_overflow = 16 * get_num_threads();
 
     return 2 * num_points + prefetch_overflow;
 }
@@ -27,9 +23,16 @@ template <typename T> inline size_t point_table_buf_size(size_t num_points)
     return sizeof(T) * point_table_size(num_points);
 }
 
+// Point tables are allocated under the memory policy of MemoryClass::POINT_TABLE. Under the default policy this is
+// aligned_alloc, and aligned_free still frees them; under any other policy they must be freed with point_table_free.
 template <typename T> inline T* point_table_alloc(size_t num_points)
 {
-    return (T*)aligned_alloc(64, point_table_buf_size<T>(num_points));
+    return (T*)policy_aligned_alloc(MemoryClass::POINT_TABLE, 64, point_table_buf_size<T>(num_points));
+}
+
+inline void point_table_free(void* point_table)
+{
+    policy_aligned_free(point_table);
 }
 
 class Pippenger {
@@ -43,19 +46,47 @@ class Pippenger {
 
     Pippenger(uint8_t const* points, size_t num_points);
 
-    Pippenger(std::string const& path, size_t num_points);
+    /**
+     * Reads the crs from the transcript files in `path`. With a `point_table_cache_dir` (see point_table_cache.hpp),
+     * the point table is mapped read only from the cache for the transcript, which is written first if needed.
+     */
+    Pippenger(std::string const& path,
+              size_t num_points,
+              std::string const& point_table_cache_dir = get_point_table_cache_dir());
 
     ~Pippenger();
 
     g1::element pippenger_unsafe(fr* scalars, size_t from, size_t range);
 
+    /**
+     * Switch to fixed-base mode: precompute shifted copies of the point table, so that an MSM performs fewer bucket
+     * reductions (see `pippenger_fixed_base`). The number of copies is the largest that fits in `memory_budget` bytes,
+     * which also covers the larger runtime state that fixed-base MSMs need.
+     * Returns false, and leaves the regular mode in place, if the budget does not fit at least two copies.
+     */
+    bool enable_fixed_base(size_t memory_budget);
+
     g1::affine_element* get_point_table() const { return monomials_; }
 
     size_t get_num_points() const { return num_points_; }
 
+    size_t get_fixed_base_num_shifts() const { return fixed_base_table_.num_shifts; }
+
   private:
+    enum class PointTableStorage {
+        // handed to us by the caller, who allocated it with aligned_alloc
+        CALLER,
+        // from point_table_alloc
+        ALLOCATED,
+        // a read only mapping of a point table cache
+        MAPPED,
+    };
+
     g1::affine_element* monomials_;
+    PointTableStorage point_table_storage_ = PointTableStorage::ALLOCATED;
+    mapped_point_table mapped_point_table_;
     size_t num_points_;
+    fixed_base_point_table fixed_base_table_;
 };
 
 } // namespace scalar_multiplication
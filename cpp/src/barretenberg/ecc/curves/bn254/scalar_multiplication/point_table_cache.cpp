@@ -0,0 +1,144 @@
+#include "./point_table_cache.hpp"
+#include "./pippenger.hpp"
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/srs/io.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+// Length of the BLAKE2b checksum at the end of every transcript file
+constexpr size_t TRANSCRIPT_CHECKSUM_LENGTH = 64;
+
+struct point_table_cache_header {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t num_points;
+    // entries in the file: the table of num_points points, then POINT_TABLE_CACHE_OVERFLOW zeroed ones
+    uint64_t num_entries;
+    uint8_t padding[32];
+};
+static_assert(sizeof(point_table_cache_header) == sizeof(g1::affine_element));
+
+// Identifies a transcript by the checksum of its first file, which covers the points every table starts with
+bool get_transcript_fingerprint(std::string const& transcript_dir, uint64_t& fingerprint)
+{
+    std::ifstream is(io::get_transcript_path(transcript_dir, 0), std::ios::binary);
+    is.seekg(-static_cast<std::streamoff>(TRANSCRIPT_CHECKSUM_LENGTH), std::ios::end);
+    uint64_t checksum[TRANSCRIPT_CHECKSUM_LENGTH / sizeof(uint64_t)];
+    if (!is.read(reinterpret_cast<char*>(checksum), TRANSCRIPT_CHECKSUM_LENGTH)) {
+        return false;
+    }
+    fingerprint = 0;
+    for (const uint64_t word : checksum) {
+        fingerprint ^= word;
+    }
+    return true;
+}
+} // namespace
+
+std::string get_point_table_cache_dir()
+{
+    const char* dir = std::getenv(POINT_TABLE_CACHE_DIR_ENV_VAR);
+    return dir != nullptr ? dir : "";
+}
+
+std::string get_point_table_cache_path(std::string const& cache_dir, std::string const& transcript_dir)
+{
+    uint64_t fingerprint = 0;
+    if (cache_dir.empty() || !get_transcript_fingerprint(transcript_dir, fingerprint)) {
+        return "";
+    }
+    std::ostringstream path;
+    path << cache_dir << "/point_table_" << std::hex << std::setw(16) << std::setfill('0') << fingerprint << ".dat";
+    return path.str();
+}
+
+mapped_point_table map_point_table_cache(std::string const& filename, const size_t num_points)
+{
+#ifndef __wasm__
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return {};
+    }
+    struct stat st;
+    point_table_cache_header header;
+    if (fstat(fd, &st) != 0 || ::read(fd, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header))) {
+        close(fd);
+        return {};
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    if (header.magic != POINT_TABLE_CACHE_MAGIC || header.version != POINT_TABLE_CACHE_VERSION ||
+        header.num_points < num_points || header.num_entries < point_table_size(num_points) ||
+        file_size != (header.num_entries + 1) * sizeof(g1::affine_element)) {
+        close(fd);
+        return {};
+    }
+    void* mapping = mmap(0, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return {};
+    }
+    return { static_cast<g1::affine_element*>(mapping) + 1, mapping, file_size };
+#else
+    (void)filename;
+    (void)num_points;
+    return {};
+#endif
+}
+
+void unmap_point_table_cache(mapped_point_table const& table)
+{
+#ifndef __wasm__
+    if (table.mapping != nullptr) {
+        munmap(table.mapping, table.mapped_size);
+    }
+#else
+    (void)table;
+#endif
+}
+
+bool write_point_table_cache(std::string const& filename,
+                             g1::affine_element const* point_table,
+                             const size_t num_points)
+{
+    point_table_cache_header header{
+        POINT_TABLE_CACHE_MAGIC, POINT_TABLE_CACHE_VERSION, num_points, 2 * num_points + POINT_TABLE_CACHE_OVERFLOW, {}
+    };
+    const std::string temporary_filename = format(filename, ".tmp.", getpid());
+    {
+        std::ofstream os(temporary_filename, std::ios::binary);
+        std::vector<char> zeros(POINT_TABLE_CACHE_OVERFLOW * sizeof(g1::affine_element), 0);
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(point_table),
+                 static_cast<std::streamsize>(2 * num_points * sizeof(g1::affine_element)));
+        os.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+        if (!os.good()) {
+            os.close();
+            std::remove(temporary_filename.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporary_filename.c_str(), filename.c_str()) != 0) {
+        std::remove(temporary_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -0,0 +1,61 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+// environment variable naming the directory that holds point table caches. Without it, nothing is cached
+constexpr const char* POINT_TABLE_CACHE_DIR_ENV_VAR = "BARRETENBERG_POINT_TABLE_CACHE_DIR";
+
+constexpr uint64_t POINT_TABLE_CACHE_MAGIC = 0x4250544243414348ULL; // "BPTBCACH"
+constexpr uint64_t POINT_TABLE_CACHE_VERSION = 1;
+// Entries past the end of the table, in the file. Covers the prefetch overflow of `point_table_size` for up to 256
+// threads, so that a cache stays usable when it is mapped by a process running with more threads than its writer.
+constexpr size_t POINT_TABLE_CACHE_OVERFLOW = 16 * 256;
+
+/**
+ * A host-local cache of the Pippenger point table built from a transcript directory.
+ *
+ * Building the table means reading the transcript, converting every point to native (Montgomery, little-endian)
+ * form and computing the endomorphism points, which takes seconds and gigabytes of private memory in every prover
+ * process. The cache file holds the finished table in exactly the layout Pippenger uses, so a process maps it read
+ * only instead: loading is immediate, and the pages are shared by all processes on the host through the page cache.
+ *
+ * The file is a 64 byte header {magic, version, num_points, num_entries} followed by the table's entries, and is named
+ * after the checksum of the transcript's first file. The table for n points starts with the table for any m < n
+ * points, so one file per transcript serves every smaller size; a request for more points than the file holds rebuilds
+ * it. Files are written to a temporary name and renamed into place, so a concurrent reader sees either the old file or
+ * the complete new one.
+ *
+ * The cache is in the host's native layout and is not meant to be copied between machines.
+ */
+struct mapped_point_table {
+    g1::affine_element* points = nullptr;
+    // the mapping starts one header before `points`
+    void* mapping = nullptr;
+    size_t mapped_size = 0;
+};
+
+// The directory named by POINT_TABLE_CACHE_DIR_ENV_VAR, or an empty string (caching disabled) if it is not set
+std::string get_point_table_cache_dir();
+
+// Path of the cache for the transcript in `transcript_dir`. Empty if the transcript cannot be identified
+std::string get_point_table_cache_path(std::string const& cache_dir, std::string const& transcript_dir);
+
+// Map a cache holding at least `num_points` points read only. Returns an empty mapping if there is no usable cache
+mapped_point_table map_point_table_cache(std::string const& filename, size_t num_points);
+
+void unmap_point_table_cache(mapped_point_table const& table);
+
+/**
+ * Write the table of `num_points` points in `point_table` to the cache `filename`. Returns false if the file could not
+ * be written; the cache is only an optimisation, so callers carry on without it.
+ */
+bool write_point_table_cache(std::string const& filename, g1::affine_element const* point_table, size_t num_points);
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
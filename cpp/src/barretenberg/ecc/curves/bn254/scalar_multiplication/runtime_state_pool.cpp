@@ -0,0 +1,158 @@
+#include "runtime_state_pool.hpp"
+
+#include "barretenberg/common/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+// A state sized for `capacity` initial points can service any MSM of up to `capacity` points.
+// (the buffers are indexed relative to the capacity of the state, not the size of the MSM)
+// The bucket and schedule buffers also depend on the bucket widths, which change if the bucket width table is replaced.
+// A state allocated before `set_num_threads` changed the thread count would split MSMs over the old count.
+bool state_fits(const pippenger_runtime_state& state, const size_t num_points, const size_t num_msms)
+{
+    return static_cast<size_t>(state.num_points) >= num_points * 2 && state.num_msms >= num_msms &&
+           state.num_threads == get_num_threads() &&
+           state.max_bucket_width >= get_max_bucket_width(num_points) &&
+           state.num_schedule_entries >= get_num_schedule_entries(num_points, num_msms);
+}
+} // namespace
+
+RuntimeStatePool::RuntimeStatePool(const size_t max_num_points, const size_t max_num_msms)
+    : max_num_points_(max_num_points)
+    , max_num_msms_(max_num_msms)
+{}
+
+void RuntimeStatePool::reserve(const size_t num_states)
+{
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(mutex_);
+#endif
+    while (idle_states_.size() < num_states) {
+        auto state = std::make_unique<pippenger_runtime_state>(max_num_points_, max_num_msms_);
+        ++stats_.num_allocations;
+        stats_.num_bytes_allocated += state->num_bytes_allocated;
+        idle_states_.emplace_back(std::move(state));
+    }
+}
+
+RuntimeStatePool::scoped_state RuntimeStatePool::checkout(const size_t num_points, const size_t num_msms)
+{
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        ++stats_.num_checkouts;
+        for (auto it = idle_states_.begin(); it != idle_states_.end();) {
+            // discard states allocated for a thread count the pool no longer has
+            if ((*it)->num_threads != get_num_threads()) {
+                stats_.num_bytes_allocated -= (*it)->num_bytes_allocated;
+                it = idle_states_.erase(it);
+                continue;
+            }
+            if (state_fits(**it, num_points, num_msms)) {
+                std::unique_ptr<pippenger_runtime_state> state = std::move(*it);
+                idle_states_.erase(it);
+                return scoped_state(this, std::move(state));
+            }
+            ++it;
+        }
+        // No idle state is large enough. Grow the pool's size target so that every state constructed from now on is
+        // sized for the largest MSM seen so far, and undersized states are eventually discarded.
+        max_num_points_ = std::max(max_num_points_, num_points);
+        max_num_msms_ = std::max(max_num_msms_, num_msms);
+        ++stats_.num_allocations;
+    }
+
+    // Construct the new state outside of the lock; page-faulting in several GB of memory takes a while.
+    auto state = std::make_unique<pippenger_runtime_state>(max_num_points_, max_num_msms_);
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        stats_.num_bytes_allocated += state->num_bytes_allocated;
+    }
+    return scoped_state(this, std::move(state));
+}
+
+void RuntimeStatePool::release(std::unique_ptr<pippenger_runtime_state> state)
+{
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(mutex_);
+#endif
+    if (!state_fits(*state, max_num_points_, max_num_msms_)) {
+        stats_.num_bytes_allocated -= state->num_bytes_allocated;
+        return;
+    }
+    idle_states_.emplace_back(std::move(state));
+}
+
+g1::element RuntimeStatePool::pippenger(fr* scalars,
+                                        g1::affine_element* points,
+                                        const size_t num_points,
+                                        bool handle_edge_cases)
+{
+    auto state = checkout(num_points);
+    g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, *state, handle_edge_cases);
+    record_scalar_histogram(state->last_scalar_histogram);
+    return result;
+}
+
+g1::element RuntimeStatePool::pippenger_unsafe(fr* scalars, g1::affine_element* points, const size_t num_points)
+{
+    auto state = checkout(num_points);
+    g1::element result = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, *state);
+    record_scalar_histogram(state->last_scalar_histogram);
+    return result;
+}
+
+std::vector<g1::element> RuntimeStatePool::pippenger_batch(const std::vector<fr*>& scalars,
+                                                          g1::affine_element* points,
+                                                          const size_t num_points,
+                                                          bool handle_edge_cases)
+{
+    auto state = checkout(num_points, std::min(scalars.size(), MAX_POOLED_BATCH_SIZE));
+    auto results = scalar_multiplication::pippenger_batch(scalars, points, num_points, *state, handle_edge_cases);
+    record_scalar_histogram(state->last_scalar_histogram);
+    return results;
+}
+
+std::vector<g1::element> RuntimeStatePool::pippenger_batch_unsafe(const std::vector<fr*>& scalars,
+                                                                 g1::affine_element* points,
+                                                                 const size_t num_points)
+{
+    auto state = checkout(num_points, std::min(scalars.size(), MAX_POOLED_BATCH_SIZE));
+    auto results = scalar_multiplication::pippenger_batch_unsafe(scalars, points, num_points, *state);
+    record_scalar_histogram(state->last_scalar_histogram);
+    return results;
+}
+
+void RuntimeStatePool::record_scalar_histogram(const scalar_histogram& histogram)
+{
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(mutex_);
+#endif
+    stats_.scalar_counts += histogram;
+}
+
+runtime_state_pool_stats RuntimeStatePool::get_stats() const
+{
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(mutex_);
+#endif
+    runtime_state_pool_stats result = stats_;
+    result.num_idle_states = idle_states_.size();
+    return result;
+}
+
+RuntimeStatePool& get_runtime_state_pool()
+{
+    static RuntimeStatePool pool;
+    return pool;
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "./scalar_multiplication.hpp"
+
+#include <memory>
+#include <vector>
+
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+// Largest number of MSMs the pool will run in one batched pippenger pass. The bucket, schedule and scratch memory of a
+// runtime state grows linearly with its batch size; larger batches are split into chunks of this size.
+constexpr size_t MAX_POOLED_BATCH_SIZE = 4;
+
+struct runtime_state_pool_stats {
+    // number of times a runtime state has been handed out
+    size_t num_checkouts = 0;
+    // number of pippenger_runtime_state objects the pool has had to construct
+    size_t num_allocations = 0;
+    // total bytes held by every runtime state the pool has constructed
+    size_t num_bytes_allocated = 0;
+    // number of runtime states currently sitting in the pool, waiting to be checked out
+    size_t num_idle_states = 0;
+    // scalars of every MSM run through the pool, by size class (zero scalars are skipped entirely, unit and small
+    // scalars take the cheaper paths of `pippenger_sparse`)
+    scalar_histogram scalar_counts;
+};
+
+/**
+ * A thread-safe pool of `pippenger_runtime_state` objects.
+ *
+ * A `pippenger_runtime_state` for 2^20 points is several GB of bucket, schedule and scratch memory. Constructing one
+ * per MSM (or per proving key) means concurrent provers in the same process continually allocate and page-fault
+ * these tables. The pool keeps every state it has ever constructed, all sized for the largest MSM seen so far.
+ *
+ * A caller checks out a state, runs its MSM and returns it (via the `scoped_state` destructor). Once the pool holds as
+ * many states as there are concurrent callers, an MSM performs no heap allocation.
+ **/
+class RuntimeStatePool {
+  public:
+    class scoped_state {
+      public:
+        scoped_state(RuntimeStatePool* pool, std::unique_ptr<pippenger_runtime_state> state)
+            : pool_(pool)
+            , state_(std::move(state))
+        {}
+        scoped_state(scoped_state&& other) = default;
+        scoped_state(const scoped_state& other) = delete;
+        scoped_state& operator=(scoped_state&& other) = delete;
+        scoped_state& operator=(const scoped_state& other) = delete;
+        ~scoped_state()
+        {
+            if (state_) {
+                pool_->release(std::move(state_));
+            }
+        }
+
+        pippenger_runtime_state& operator*() { return *state_; }
+        pippenger_runtime_state* operator->() { return state_.get(); }
+
+      private:
+        RuntimeStatePool* pool_;
+        std::unique_ptr<pippenger_runtime_state> state_;
+    };
+
+    /**
+     * @param max_num_points the MSM size (before the endomorphism split) that newly constructed states are sized for.
+     * @param max_num_msms the batch size (see `pippenger_batch`) that newly constructed states are sized for.
+     * States are constructed lazily; call `reserve` to pay the allocation cost up front.
+     **/
+    RuntimeStatePool(const size_t max_num_points = 0, const size_t max_num_msms = 1);
+    RuntimeStatePool(const RuntimeStatePool& other) = delete;
+    RuntimeStatePool& operator=(const RuntimeStatePool& other) = delete;
+
+    void reserve(const size_t num_states);
+
+    scoped_state checkout(const size_t num_points, const size_t num_msms = 1);
+
+    g1::element pippenger(fr* scalars,
+                          g1::affine_element* points,
+                          const size_t num_points,
+                          bool handle_edge_cases = true);
+
+    g1::element pippenger_unsafe(fr* scalars, g1::affine_element* points, const size_t num_points);
+
+    std::vector<g1::element> pippenger_batch(const std::vector<fr*>& scalars,
+                                             g1::affine_element* points,
+                                             const size_t num_points,
+                                             bool handle_edge_cases = true);
+
+    std::vector<g1::element> pippenger_batch_unsafe(const std::vector<fr*>& scalars,
+                                                    g1::affine_element* points,
+                                                    const size_t num_points);
+
+    runtime_state_pool_stats get_stats() const;
+
+    size_t get_max_num_points() const { return max_num_points_; }
+
+  private:
+    void release(std::unique_ptr<pippenger_runtime_state> state);
+
+    void record_scalar_histogram(const scalar_histogram& histogram);
+
+    size_t max_num_points_;
+    size_t max_num_msms_;
+    std::vector<std::unique_ptr<pippenger_runtime_state>> idle_states_;
+    runtime_state_pool_stats stats_;
+#ifndef NO_MULTITHREADING
+    mutable std::mutex mutex_;
+#endif
+};
+
+/**
+ * The process-wide pool, shared by every prover in the process.
+ **/
+RuntimeStatePool& get_runtime_state_pool();
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -1,68 +1,112 @@
 #include "runtime_states.hpp"
 
 #include "barretenberg/common/mem.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
+#include <algorithm>
 
 namespace barretenberg {
 namespace scalar_multiplication {
 
-pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points)
+size_t get_max_bucket_width(const size_t num_initial_points)
+{
+    // pippenger evaluates an MSM in power-of-two slices
+    size_t max_bucket_width = get_calibrated_bucket_width(num_initial_points);
+    for (size_t num_points = 1; num_points < num_initial_points; num_points <<= 1) {
+        max_bucket_width = std::max(max_bucket_width, get_calibrated_bucket_width(num_points));
+    }
+    return max_bucket_width;
+}
+
+size_t get_num_schedule_entries(const size_t num_initial_points, const size_t num_msms)
+{
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(static_cast<uint64_t>(num_points))));
+    // a smaller slice needs more schedule entries than the whole MSM if its calibrated width is much narrower
+    size_t num_entries = num_points * get_calibrated_num_rounds(num_points_floor);
+    for (size_t slice_points = 2; slice_points < num_points_floor; slice_points <<= 1) {
+        num_entries = std::max(num_entries, slice_points * get_calibrated_num_rounds(slice_points));
+    }
+    return num_entries * num_msms;
+}
+
+size_t get_runtime_state_num_bytes(const size_t num_initial_points, const size_t num_msms)
+{
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_schedule_points = num_points * num_msms;
+    const size_t num_buckets = num_msms * static_cast<size_t>(1U << get_max_bucket_width(num_initial_points));
+    const size_t num_threads = get_num_threads();
+    const size_t prefetch_overflow = 16 * num_threads;
+
+    return (get_num_schedule_entries(num_initial_points, num_msms) + prefetch_overflow) * sizeof(uint64_t) +
+           pad(num_schedule_points * sizeof(bool), 64) +
+           2 * (num_schedule_points * 2 + (num_threads * 16)) * sizeof(g1::affine_element) +
+           num_schedule_points * sizeof(g1::affine_element) +
+           num_threads * num_buckets * (2 * sizeof(uint32_t) + sizeof(bool)) +
+           MAX_NUM_ROUNDS * (num_msms + 1) * sizeof(uint64_t) + num_threads * num_msms * sizeof(g1::element) +
+           pad(num_initial_points, 64) + num_initial_points * sizeof(fr) +
+           (num_points + prefetch_overflow) * sizeof(g1::affine_element);
+}
+
+pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points, const size_t num_initial_msms)
 {
-    constexpr size_t MAX_NUM_ROUNDS = 256;
     num_points = num_initial_points * 2;
-    const size_t num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const size_t num_buckets = static_cast<size_t>(
-        1U << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
-#ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
+    num_msms = num_initial_msms;
+    // the point schedule, skew table and affine addition buffers hold one row per MSM in a batch
+    const size_t num_schedule_points = static_cast<size_t>(num_points) * num_msms;
+    max_bucket_width = get_max_bucket_width(num_initial_points);
+    num_schedule_entries = get_num_schedule_entries(num_initial_points, num_msms);
+    const size_t num_buckets = num_msms * static_cast<size_t>(1U << max_bucket_width);
+    num_threads = get_num_threads();
     const size_t prefetch_overflow = 16 * num_threads;
-    const size_t num_rounds =
-        static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
-    point_schedule = (uint64_t*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * num_rounds + prefetch_overflow) * sizeof(uint64_t)));
-    skew_table = (bool*)(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64)));
+    const size_t num_rounds = (num_schedule_points > 0) ? num_schedule_entries / num_schedule_points : 0;
+    point_schedule = (uint64_t*)(aligned_alloc(64, (num_schedule_entries + prefetch_overflow) * sizeof(uint64_t)));
+    skew_table = (bool*)(aligned_alloc(64, pad(static_cast<size_t>(num_schedule_points) * sizeof(bool), 64)));
     point_pairs_1 = (g1::affine_element*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
+        64, (static_cast<size_t>(num_schedule_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
     point_pairs_2 = (g1::affine_element*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
-    scratch_space = (fq*)(aligned_alloc(64, static_cast<size_t>(num_points) * sizeof(g1::affine_element)));
+        64, (static_cast<size_t>(num_schedule_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
+    scratch_space = (fq*)(aligned_alloc(64, static_cast<size_t>(num_schedule_points) * sizeof(g1::affine_element)));
     bucket_counts = (uint32_t*)(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t)));
     bit_counts = (uint32_t*)(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t)));
     bucket_empty_status = (bool*)(aligned_alloc(64, num_threads * num_buckets * sizeof(bool)));
-    round_counts = (uint64_t*)(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t)));
-
-    const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; ++i) {
-        const size_t thread_offset = i * points_per_thread;
-        memset((void*)(point_pairs_1 + thread_offset + (i * 16)),
-               0,
-               (points_per_thread + 16) * sizeof(g1::affine_element));
-        memset((void*)(point_pairs_2 + thread_offset + (i * 16)),
-               0,
-               (points_per_thread + 16) * sizeof(g1::affine_element));
-        memset((void*)(scratch_space + thread_offset), 0, (points_per_thread) * sizeof(fq));
-        for (size_t j = 0; j < num_rounds; ++j) {
-            const size_t round_offset = (j * static_cast<size_t>(num_points));
-            memset((void*)(point_schedule + round_offset + thread_offset), 0, points_per_thread * sizeof(uint64_t));
+    round_counts = (uint64_t*)(aligned_alloc(32, MAX_NUM_ROUNDS * (num_msms + 1) * sizeof(uint64_t)));
+    thread_accumulators = (g1::element*)(aligned_alloc(64, num_threads * num_msms * sizeof(g1::element)));
+    sparse_scalar_classes = (uint8_t*)(aligned_alloc(64, pad(num_initial_points, 64)));
+    sparse_scalars = (fr*)(aligned_alloc(64, num_initial_points * sizeof(fr)));
+    // the point pairs of the large and small scalars, followed by the unit points
+    sparse_points =
+        (g1::affine_element*)(aligned_alloc(64, (num_points + prefetch_overflow) * sizeof(g1::affine_element)));
+
+    num_bytes_allocated = get_runtime_state_num_bytes(num_initial_points, num_initial_msms);
+
+    const size_t points_per_thread = static_cast<size_t>(num_schedule_points) / num_threads;
+    parallel_for(num_threads, [&](const size_t threads_start, const size_t threads_end) {
+        for (size_t i = threads_start; i < threads_end; ++i) {
+            const size_t thread_offset = i * points_per_thread;
+            memset((void*)(point_pairs_1 + thread_offset + (i * 16)),
+                   0,
+                   (points_per_thread + 16) * sizeof(g1::affine_element));
+            memset((void*)(point_pairs_2 + thread_offset + (i * 16)),
+                   0,
+                   (points_per_thread + 16) * sizeof(g1::affine_element));
+            memset((void*)(scratch_space + thread_offset), 0, (points_per_thread) * sizeof(fq));
+            for (size_t j = 0; j < num_rounds; ++j) {
+                const size_t round_offset = (j * static_cast<size_t>(num_schedule_points));
+                memset((void*)(point_schedule + round_offset + thread_offset), 0, points_per_thread * sizeof(uint64_t));
+            }
+            memset((void*)(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
         }
-        memset((void*)(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
-    }
+    });
+    memset((void*)sparse_scalar_classes, 0, pad(num_initial_points, 64));
+    memset((void*)sparse_scalars, 0, num_initial_points * sizeof(fr));
+    memset((void*)sparse_points, 0, (num_points + prefetch_overflow) * sizeof(g1::affine_element));
 
     memset((void*)bucket_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
     memset((void*)bit_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
     memset((void*)bucket_empty_status, 0, num_threads * num_buckets * sizeof(bool));
-    memset((void*)round_counts, 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
+    memset((void*)round_counts, 0, MAX_NUM_ROUNDS * (num_msms + 1) * sizeof(uint64_t));
 }
 
 pippenger_runtime_state::pippenger_runtime_state(pippenger_runtime_state&& other)
@@ -76,6 +120,10 @@ pippenger_runtime_state::pippenger_runtime_state(pippenger_runtime_state&& other
     bucket_counts = other.bucket_counts;
     bucket_empty_status = other.bucket_empty_status;
     round_counts = other.round_counts;
+    thread_accumulators = other.thread_accumulators;
+    sparse_scalar_classes = other.sparse_scalar_classes;
+    sparse_scalars = other.sparse_scalars;
+    sparse_points = other.sparse_points;
 
     other.point_schedule = nullptr;
     other.skew_table = nullptr;
@@ -86,8 +134,19 @@ pippenger_runtime_state::pippenger_runtime_state(pippenger_runtime_state&& other
     other.bucket_counts = nullptr;
     other.bucket_empty_status = nullptr;
     other.round_counts = nullptr;
+    other.thread_accumulators = nullptr;
+    other.sparse_scalar_classes = nullptr;
+    other.sparse_scalars = nullptr;
+    other.sparse_points = nullptr;
 
     num_points = other.num_points;
+    num_msms = other.num_msms;
+    num_threads = other.num_threads;
+    max_bucket_width = other.max_bucket_width;
+    num_schedule_entries = other.num_schedule_entries;
+    num_bytes_allocated = other.num_bytes_allocated;
+    last_scalar_histogram = other.last_scalar_histogram;
+    bucket_strategy = other.bucket_strategy;
 }
 
 pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_state&& other)
@@ -128,6 +187,22 @@ pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_st
         aligned_free(round_counts);
     }
 
+    if (thread_accumulators) {
+        aligned_free(thread_accumulators);
+    }
+
+    if (sparse_scalar_classes) {
+        aligned_free(sparse_scalar_classes);
+    }
+
+    if (sparse_scalars) {
+        aligned_free(sparse_scalars);
+    }
+
+    if (sparse_points) {
+        aligned_free(sparse_points);
+    }
+
     point_schedule = other.point_schedule;
     skew_table = other.skew_table;
     point_pairs_1 = other.point_pairs_1;
@@ -137,6 +212,10 @@ pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_st
     bucket_counts = other.bucket_counts;
     bucket_empty_status = other.bucket_empty_status;
     round_counts = other.round_counts;
+    thread_accumulators = other.thread_accumulators;
+    sparse_scalar_classes = other.sparse_scalar_classes;
+    sparse_scalars = other.sparse_scalars;
+    sparse_points = other.sparse_points;
 
     other.point_schedule = nullptr;
     other.skew_table = nullptr;
@@ -147,17 +226,27 @@ pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_st
     other.bucket_counts = nullptr;
     other.bucket_empty_status = nullptr;
     other.round_counts = nullptr;
+    other.thread_accumulators = nullptr;
+    other.sparse_scalar_classes = nullptr;
+    other.sparse_scalars = nullptr;
+    other.sparse_points = nullptr;
 
     num_points = other.num_points;
+    num_msms = other.num_msms;
+    num_threads = other.num_threads;
+    max_bucket_width = other.max_bucket_width;
+    num_schedule_entries = other.num_schedule_entries;
+    num_bytes_allocated = other.num_bytes_allocated;
+    last_scalar_histogram = other.last_scalar_histogram;
+    bucket_strategy = other.bucket_strategy;
     return *this;
 }
 
 affine_product_runtime_state pippenger_runtime_state::get_affine_product_runtime_state(const size_t num_threads,
                                                                                        const size_t thread_index)
 {
-    const size_t points_per_thread = static_cast<size_t>(num_points / num_threads);
-    const size_t num_buckets = static_cast<size_t>(
-        1U << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_points) / 2));
+    const size_t points_per_thread = static_cast<size_t>((num_points * num_msms) / num_threads);
+    const size_t num_buckets = num_msms * static_cast<size_t>(1U << max_bucket_width);
 
     scalar_multiplication::affine_product_runtime_state product_state;
 
@@ -207,6 +296,22 @@ pippenger_runtime_state::~pippenger_runtime_state()
     if (round_counts) {
         aligned_free(round_counts);
     }
+
+    if (thread_accumulators) {
+        aligned_free(thread_accumulators);
+    }
+
+    if (sparse_scalar_classes) {
+        aligned_free(sparse_scalar_classes);
+    }
+
+    if (sparse_scalars) {
+        aligned_free(sparse_scalars);
+    }
+
+    if (sparse_points) {
+        aligned_free(sparse_points);
+    }
 }
 } // namespace scalar_multiplication
 } // namespace barretenberg
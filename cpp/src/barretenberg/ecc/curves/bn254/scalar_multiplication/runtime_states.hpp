@@ -56,12 +56,30 @@ constexpr size_t get_optimal_bucket_width(const size_t num_points)
     return 1;
 }
 
+constexpr size_t MAX_NUM_ROUNDS = 256;
+
 constexpr size_t get_num_rounds(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
     return WNAF_SIZE(bits_per_bucket + 1);
 }
 
+/**
+ * The bucket width (and number of rounds) pippenger uses on this machine: the measured width from the bucket width
+ * table (see bucket_width_table.hpp) if it covers this MSM size and thread count, `get_optimal_bucket_width` otherwise.
+ * Arguments are as for `get_optimal_bucket_width` and `get_num_rounds`.
+ **/
+size_t get_calibrated_bucket_width(const size_t num_points);
+size_t get_calibrated_num_rounds(const size_t num_points);
+
+// the widest bucket window of any MSM of up to `num_initial_points` points. Unlike `get_optimal_bucket_width`, the
+// calibrated width need not grow with the number of points
+size_t get_max_bucket_width(const size_t num_initial_points);
+
+// the number of point schedule entries (points * rounds, over every MSM of a batch) that any MSM of up to
+// `num_initial_points` points needs
+size_t get_num_schedule_entries(const size_t num_initial_points, const size_t num_msms = 1);
+
 struct affine_product_runtime_state {
     g1::affine_element* points;
     g1::affine_element* point_pairs_1;
@@ -75,6 +93,50 @@ struct affine_product_runtime_state {
     bool* bucket_empty_status;
 };
 
+/**
+ * The scalars of an MSM, counted by size class. Zero scalars contribute nothing, the points of unit scalars can be
+ * summed directly and small scalars only populate the lowest few wnaf rounds (see `pippenger_sparse`).
+ **/
+struct scalar_histogram {
+    size_t num_zero = 0;
+    size_t num_one = 0;
+    size_t num_small = 0;
+    size_t num_large = 0;
+
+    scalar_histogram& operator+=(const scalar_histogram& other)
+    {
+        num_zero += other.num_zero;
+        num_one += other.num_one;
+        num_small += other.num_small;
+        num_large += other.num_large;
+        return *this;
+    }
+};
+
+/**
+ * How each pippenger round adds its points into buckets.
+ **/
+enum BucketStrategy : uint8_t {
+    // pick one of the strategies below by the size of the MSM (see `select_bucket_strategy`)
+    AUTO_BUCKETS,
+    // radix sort the round schedule by bucket, then reduce the points of each bucket with addition chains
+    SORTED_BUCKETS,
+    // add the unsorted round schedule straight into affine buckets, in batches that share one field inversion
+    AFFINE_BUCKETS,
+};
+
+/**
+ * The number of bytes a `pippenger_runtime_state` constructed for these arguments allocates.
+ **/
+size_t get_runtime_state_num_bytes(const size_t num_initial_points, const size_t num_msms = 1);
+
+/**
+ * Scratch memory for the pippenger algorithm.
+ *
+ * A state constructed for `num_initial_msms` MSMs can evaluate a batch of up to that many MSMs over the same points
+ * (see `pippenger_batch`). The point schedule, skew table and affine addition buffers then hold one row per MSM, and
+ * `round_counts` holds the combined per-round counts followed by `MAX_NUM_ROUNDS` counts for each MSM.
+ **/
 struct pippenger_runtime_state {
     uint64_t* point_schedule;
     bool* skew_table;
@@ -85,9 +147,28 @@ struct pippenger_runtime_state {
     uint32_t* bit_counts;
     bool* bucket_empty_status;
     uint64_t* round_counts;
+    g1::element* thread_accumulators;
+    // the scalar classes, and the gathered scalars and point pairs, of one MSM on the sparse path (see
+    // `pippenger_sparse`)
+    uint8_t* sparse_scalar_classes;
+    fr* sparse_scalars;
+    g1::affine_element* sparse_points;
     uint64_t num_points;
+    size_t num_msms;
+    // the number of threads the per-thread buffers were allocated for. An MSM evaluated with this state is split into
+    // this many parts, however many threads the thread pool has by then
+    size_t num_threads;
+    // the bucket width and point schedule size the buffers were allocated for (see `get_max_bucket_width` and
+    // `get_num_schedule_entries`)
+    size_t max_bucket_width;
+    size_t num_schedule_entries;
+    size_t num_bytes_allocated;
+    // histogram of the scalars of the most recent MSM (or batch of MSMs) evaluated with this state
+    scalar_histogram last_scalar_histogram;
+    // bucket accumulation strategy of every MSM evaluated with this state
+    BucketStrategy bucket_strategy = AUTO_BUCKETS;
 
-    pippenger_runtime_state(const size_t num_initial_points);
+    pippenger_runtime_state(const size_t num_initial_points, const size_t num_initial_msms = 1);
     pippenger_runtime_state(pippenger_runtime_state&& other);
     pippenger_runtime_state& operator=(pippenger_runtime_state&& other);
     ~pippenger_runtime_state();
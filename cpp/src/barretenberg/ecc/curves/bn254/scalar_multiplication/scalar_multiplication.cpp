@@ -1,14 +1,16 @@
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/mem.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <vector>
 
 #include "../../../groups/wnaf.hpp"
 #include "../fq.hpp"
@@ -17,10 +19,6 @@
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
-
 #define BBERG_SCALAR_MULTIPLICATION_FETCH_BLOCK                                                                        \
     __builtin_prefetch(state.points + (state.point_schedule[schedule_it + 16] >> 32ULL));                              \
     __builtin_prefetch(state.points + (state.point_schedule[schedule_it + 17] >> 32ULL));                              \
@@ -186,67 +184,88 @@ void generate_pippenger_point_table(g1::affine_element* points, g1::affine_eleme
  *
  * At the end of `compute_wnaf_states`, `state.wnaf_table` will contain our wnaf entries, but unsorted.
  *
+ * When evaluating a batch of MSMs over the same points (see `pippenger_batch`), each round of the point schedule holds
+ * one row of `num_initial_points * 2` entries per MSM. The MSM's bucket indices are offset by `msm_index` times the
+ * number of buckets, so that the buckets of every MSM in the batch can be reduced together.
+ *
  * @param point_schedule Pointer to the output array with all WNAFs
  * @param input_skew_table Pointer to the output array with all skews
  * @param round_counts The number of points in each round
  * @param scalars The pointer to the region with initial scalars that need to be converted into WNAF
  * @param num_initial_points The number of points before the endomorphism split
+ * @param num_msms The number of MSMs sharing the point schedule
+ * @param msm_index The index of this MSM in the batch
  **/
 void compute_wnaf_states(uint64_t* point_schedule,
                          bool* input_skew_table,
                          uint64_t* round_counts,
                          const fr* scalars,
-                         const size_t num_initial_points)
+                         const size_t num_initial_points,
+                         const size_t num_msms,
+                         const size_t msm_index)
+{
+    compute_wnaf_states_with_bucket_width(point_schedule,
+                                          input_skew_table,
+                                          round_counts,
+                                          scalars,
+                                          num_initial_points,
+                                          get_calibrated_bucket_width(num_initial_points),
+                                          num_msms,
+                                          msm_index);
+}
+
+/**
+ * As `compute_wnaf_states`, but with a caller-provided bucket width rather than the optimal width for
+ * `num_initial_points`. The schedule then holds `WNAF_SIZE(bits_per_bucket + 1)` rounds.
+ **/
+void compute_wnaf_states_with_bucket_width(uint64_t* point_schedule,
+                                           bool* input_skew_table,
+                                           uint64_t* round_counts,
+                                           const fr* scalars,
+                                           const size_t num_initial_points,
+                                           const size_t bits_per_bucket,
+                                           const size_t num_msms,
+                                           const size_t msm_index)
 {
     const size_t num_points = num_initial_points * 2;
-    constexpr size_t MAX_NUM_ROUNDS = 256;
-    constexpr size_t MAX_NUM_THREADS = 128;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
-#ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
-    const size_t num_initial_points_per_thread = num_initial_points / num_threads;
-    const size_t num_points_per_thread = num_points / num_threads;
-    std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
-    for (size_t i = 0; i < num_threads; ++i) {
-        for (size_t j = 0; j < num_rounds; ++j) {
-            thread_round_counts[i][j] = 0;
-        }
-    }
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; ++i) {
-        fr T0;
-        uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
-        const fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
-        bool* skew_table = &input_skew_table[(2 * i) * num_initial_points_per_thread];
-        uint64_t offset = i * num_points_per_thread;
-
-        for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
-            T0 = thread_scalars[j].from_montgomery_form();
-            fr::split_into_endomorphism_scalars(T0, T0, *(fr*)&T0.data[2]);
-
-            wnaf::fixed_wnaf_with_counts(&T0.data[0],
-                                         &wnaf_table[(j << 1UL)],
-                                         skew_table[j << 1ULL],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1ULL) + offset) << 32ULL,
-                                         num_points,
-                                         wnaf_bits);
-            wnaf::fixed_wnaf_with_counts(&T0.data[2],
-                                         &wnaf_table[(j << 1UL) + 1],
-                                         skew_table[(j << 1UL) + 1],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1UL) + offset + 1) << 32UL,
-                                         num_points,
-                                         wnaf_bits);
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+    const size_t schedule_stride = num_points * num_msms;
+    const uint64_t bucket_offset = static_cast<uint64_t>(msm_index) << bits_per_bucket;
+    const size_t num_threads = get_num_threads();
+    const size_t num_initial_points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    std::vector<std::array<uint64_t, MAX_NUM_ROUNDS>> thread_round_counts(num_threads);
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t start = std::min(i * num_initial_points_per_thread, num_initial_points);
+            const size_t end = std::min(start + num_initial_points_per_thread, num_initial_points);
+            fr T0;
+            uint64_t* wnaf_table = &point_schedule[msm_index * num_points + 2 * start];
+            const fr* thread_scalars = &scalars[start];
+            bool* skew_table = &input_skew_table[msm_index * num_points + 2 * start];
+            uint64_t offset = 2 * start;
+
+            for (uint64_t j = 0; j < end - start; ++j) {
+                T0 = thread_scalars[j].from_montgomery_form();
+                fr::split_into_endomorphism_scalars(T0, T0, *(fr*)&T0.data[2]);
+
+                wnaf::fixed_wnaf_with_counts(&T0.data[0],
+                                             &wnaf_table[(j << 1UL)],
+                                             skew_table[j << 1ULL],
+                                             &thread_round_counts[i][0],
+                                             (((j << 1ULL) + offset) << 32ULL) | bucket_offset,
+                                             schedule_stride,
+                                             wnaf_bits);
+                wnaf::fixed_wnaf_with_counts(&T0.data[2],
+                                             &wnaf_table[(j << 1UL) + 1],
+                                             skew_table[(j << 1UL) + 1],
+                                             &thread_round_counts[i][0],
+                                             (((j << 1UL) + offset + 1) << 32UL) | bucket_offset,
+                                             schedule_stride,
+                                             wnaf_bits);
+            }
         }
-    }
+    });
 
     for (size_t i = 0; i < num_rounds; ++i) {
         round_counts[i] = 0;
@@ -263,18 +282,65 @@ void compute_wnaf_states(uint64_t* point_schedule,
  *  We currently don't multi-thread the inner sorting algorithm, and just split our threads over the number of rounds.
  *  A multi-threaded sorting algorithm could be more efficient, but the total runtime of `organize_buckets` is <5% of
  *  pippenger's runtime, so not a priority.
+ *
+ *  For a batch of MSMs, each MSM's row is sorted independently. Because the bucket indices of MSM `i` are offset by
+ *  `i * num_buckets`, concatenating the valid (non-empty) entries of each row yields a single round schedule that is
+ *  sorted by bucket across the whole batch. `round_counts` must then contain the combined round counts, followed by
+ *  `MAX_NUM_ROUNDS` round counts per MSM.
+ *
+ *  A single MSM's row relies on the sort to move its empty entries (all ones) behind the valid ones: the sort key is one
+ *  bit wider than a bucket index, and that bit is only set in empty entries. In a batch it is the low bit of the MSM
+ *  index instead, so the valid entries of each row are first compacted to its front, and only those are sorted.
  **/
-void organize_buckets(uint64_t* point_schedule, const uint64_t*, const size_t num_points)
+void organize_buckets(uint64_t* point_schedule,
+                      const uint64_t* round_counts,
+                      const size_t num_points,
+                      const size_t num_msms)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_rounds; ++i) {
-        scalar_multiplication::process_buckets(&point_schedule[i * num_points],
-                                               num_points,
-                                               static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
+    const size_t num_rounds = get_calibrated_num_rounds(num_points);
+    const size_t schedule_stride = num_points * num_msms;
+    parallel_for(num_rounds * num_msms, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t round = i / num_msms;
+            const size_t msm_index = i % num_msms;
+            // rows without any wnaf entries (e.g. the high rounds of an MSM over small scalars) need no sorting
+            const uint64_t num_row_entries =
+                (num_msms == 1) ? round_counts[round] : round_counts[(MAX_NUM_ROUNDS * (msm_index + 1)) + round];
+            if (num_row_entries == 0) {
+                continue;
+            }
+            uint64_t* row = &point_schedule[round * schedule_stride + msm_index * num_points];
+            size_t num_sorted_entries = num_points;
+            if (num_msms > 1) {
+                size_t num_valid_entries = 0;
+                for (size_t j = 0; j < num_points; ++j) {
+                    if (row[j] != 0xffffffffffffffffULL) {
+                        row[num_valid_entries++] = row[j];
+                    }
+                }
+                ASSERT(num_valid_entries == num_row_entries);
+                num_sorted_entries = num_valid_entries;
+            }
+            scalar_multiplication::process_buckets(
+                row, num_sorted_entries, static_cast<uint32_t>(get_calibrated_bucket_width(num_points / 2)) + 1);
+        }
+    });
+    if (num_msms == 1) {
+        return;
     }
+    parallel_for(num_rounds, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            uint64_t* round_schedule = &point_schedule[i * schedule_stride];
+            size_t num_round_entries = round_counts[(MAX_NUM_ROUNDS * 1) + i];
+            for (size_t j = 1; j < num_msms; ++j) {
+                const size_t num_msm_entries = round_counts[(MAX_NUM_ROUNDS * (j + 1)) + i];
+                memmove((void*)(round_schedule + num_round_entries),
+                        (void*)(round_schedule + j * num_points),
+                        num_msm_entries * sizeof(uint64_t));
+                num_round_entries += num_msm_entries;
+            }
+        }
+    });
 }
 
 /**
@@ -723,123 +789,417 @@ uint32_t construct_addition_chains(affine_product_runtime_state& state, bool emp
     return max_bucket_bits;
 }
 
-g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
-                                      g1::affine_element* points,
-                                      const size_t num_points,
-                                      bool handle_edge_cases)
+namespace {
+/**
+ * Concatenate the (reduced) buckets `first_bucket..last_bucket` of a round into `msm_accumulators`, splitting the
+ * bucket range at each MSM boundary. `output_buckets` holds the `num_output_buckets` non-empty buckets of the range in
+ * increasing order, `bucket_empty_status` is indexed relative to `first_bucket` (which must not be empty).
+ **/
+void concatenate_buckets(const g1::affine_element* output_buckets,
+                         const size_t num_output_buckets,
+                         const bool* bucket_empty_status,
+                         const size_t first_bucket,
+                         const size_t last_bucket,
+                         const size_t bits_per_bucket,
+                         g1::element* msm_accumulators)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
-#ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
-#else
-    const size_t num_threads = 1;
-#endif
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
+    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+    // algorithm can use mixed addition formulae, instead of full addition formulae
+    size_t output_it = num_output_buckets - 1;
+
+    // iterate over the MSMs whose buckets fall in this thread's range, starting with the highest
+    const size_t first_msm = first_bucket >> bits_per_bucket;
+    const size_t last_msm = last_bucket >> bits_per_bucket;
+    for (size_t m = last_msm + 1; m > first_msm; --m) {
+        const size_t msm_index = m - 1;
+        const size_t msm_bucket_offset = msm_index << bits_per_bucket;
+        const size_t msm_first_bucket = std::max(first_bucket, msm_bucket_offset);
+        const size_t msm_last_bucket = std::min(last_bucket, msm_bucket_offset + (1UL << bits_per_bucket) - 1);
+
+        g1::element accumulator;
+        accumulator.self_set_infinity();
+        g1::element running_sum;
+        running_sum.self_set_infinity();
+
+        for (size_t k = msm_last_bucket - first_bucket; k > msm_first_bucket - first_bucket; --k) {
+            if (__builtin_expect(!bucket_empty_status[k], 1)) {
+                running_sum += (output_buckets[output_it]);
+                --output_it;
+            }
+            accumulator += running_sum;
+        }
+        // The thread's first bucket is never empty, but the first bucket of a later MSM can be
+        if (!bucket_empty_status[msm_first_bucket - first_bucket]) {
+            running_sum += output_buckets[output_it];
+            --output_it;
+        }
+        accumulator.self_dbl();
+        accumulator += running_sum;
+
+        // we now need to scale up 'running sum' up to the value of the first bucket.
+        // e.g. if first bucket is 0, no scaling
+        // if first bucket is 1, we need to add (2 * running_sum)
+        const size_t scaling_bucket = msm_first_bucket - msm_bucket_offset;
+        if (scaling_bucket > 0) {
+            uint32_t multiplier = static_cast<uint32_t>(scaling_bucket << 1UL);
+            size_t shift = numeric::get_msb(multiplier);
+            g1::element rolling_accumulator = g1::point_at_infinity;
+            bool init = false;
+            while (shift != static_cast<size_t>(-1)) {
+                if (init) {
+                    rolling_accumulator.self_dbl();
+                    if (((multiplier >> shift) & 1)) {
+                        rolling_accumulator += running_sum;
+                    }
+                } else {
+                    rolling_accumulator += running_sum;
+                }
+                init = true;
+                shift -= 1;
+            }
+            accumulator += rolling_accumulator;
+        }
+        msm_accumulators[msm_index] += accumulator;
+    }
+}
 
-    std::unique_ptr<g1::element[], decltype(&aligned_free)> thread_accumulators(
-        static_cast<g1::element*>(aligned_alloc(64, num_threads * sizeof(g1::element))), &aligned_free);
+/**
+ * Add thread `thread_index`'s tranche of a sorted round schedule into buckets, and concatenate the buckets of each MSM
+ * whose bucket range overlaps the tranche into `msm_accumulators`.
+ **/
+void evaluate_round_tranche(pippenger_runtime_state& state,
+                            g1::affine_element* points,
+                            uint64_t* round_schedule,
+                            const uint64_t num_round_points,
+                            const size_t num_threads,
+                            const size_t thread_index,
+                            const size_t bits_per_bucket,
+                            g1::element* msm_accumulators,
+                            bool handle_edge_cases)
+{
+    if ((num_round_points == 0) || (num_round_points < num_threads && thread_index != num_threads - 1)) {
+        return;
+    }
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
-        thread_accumulators[j].self_set_infinity();
+    const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+    const uint64_t leftovers =
+        (thread_index == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+
+    uint64_t* thread_point_schedule = &round_schedule[thread_index * num_round_points_per_thread];
+    const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+    const size_t last_bucket = thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+    const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+
+    affine_product_runtime_state product_state = state.get_affine_product_runtime_state(num_threads, thread_index);
+    product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+    product_state.points = points;
+    product_state.point_schedule = thread_point_schedule;
+    product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+    g1::affine_element* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+
+    concatenate_buckets(output_buckets,
+                        product_state.num_points,
+                        product_state.bucket_empty_status,
+                        first_bucket,
+                        last_bucket,
+                        bits_per_bucket,
+                        msm_accumulators);
+}
 
-        for (size_t i = 0; i < num_rounds; ++i) {
+/**
+ * Add the entries of an unsorted round schedule that fall in thread `thread_index`'s share of the buckets straight into
+ * affine buckets, then concatenate the buckets into `msm_accumulators`.
+ *
+ * Each affine addition needs a field inversion, so additions are collected into a batch of up to
+ * `AFFINE_BUCKETS_BATCH_SIZE` that shares a single inversion (Montgomery's trick, see `add_affine_points`). The
+ * additions of a batch must be independent: an entry whose bucket already has an addition in the batch is parked in a
+ * conflict queue, and retried once the batch has been evaluated.
+ *
+ * Compared to the sorted schedule, this skips the radix sort of `organize_buckets` and the addition chain construction
+ * of `reduce_buckets`. In exchange, the buckets are accessed in random order (they are 64 byte affine points, so this
+ * is cheap while a thread's buckets fit in cache) and every thread scans the whole round schedule.
+ **/
+void evaluate_round_affine_buckets(pippenger_runtime_state& state,
+                                   g1::affine_element* points,
+                                   const uint64_t* round_schedule,
+                                   const size_t num_schedule_entries,
+                                   const uint64_t num_round_points,
+                                   const size_t num_threads,
+                                   const size_t thread_index,
+                                   const size_t bits_per_bucket,
+                                   const size_t num_msms,
+                                   g1::element* msm_accumulators,
+                                   bool handle_edge_cases)
+{
+    const size_t num_total_buckets = num_msms << bits_per_bucket;
+    const size_t num_buckets_per_thread = (num_total_buckets + num_threads - 1) / num_threads;
+    const size_t range_start = std::min(thread_index * num_buckets_per_thread, num_total_buckets);
+    const size_t range_end = std::min(range_start + num_buckets_per_thread, num_total_buckets);
+    if (num_round_points == 0 || range_start == range_end) {
+        return;
+    }
+    const size_t num_range_buckets = range_end - range_start;
+
+    // the thread's buckets live in its `point_pairs_1` buffer, the pending batch and conflict queue (of schedule
+    // entries) in its `point_pairs_2` buffer and the batch inversion products in its scratch space
+    affine_product_runtime_state product_state = state.get_affine_product_runtime_state(num_threads, thread_index);
+    const size_t points_per_thread = static_cast<size_t>(state.num_points * state.num_msms) / num_threads;
+    const size_t max_batch_size = std::min(AFFINE_BUCKETS_BATCH_SIZE, points_per_thread / 2);
+    g1::affine_element* buckets = product_state.point_pairs_1;
+    bool* bucket_empty_status = product_state.bucket_empty_status;
+    uint32_t* bucket_in_batch = product_state.bucket_counts;
+    uint64_t* batch = reinterpret_cast<uint64_t*>(product_state.point_pairs_2);
+    uint64_t* queue = batch + max_batch_size;
+    fq* inversion_products = product_state.scratch_space;
+
+    memset((void*)bucket_empty_status, 1, num_range_buckets * sizeof(bool));
+    memset((void*)bucket_in_batch, 0, num_range_buckets * sizeof(uint32_t));
+    size_t batch_size = 0;
+    size_t queue_size = 0;
+
+    // returns false if the entry's bucket already has an addition in the batch
+    const auto try_add_entry = [&](const uint64_t entry) {
+        const size_t bucket = (entry & 0x7fffffffU) - range_start;
+        if (bucket_in_batch[bucket]) {
+            return false;
+        }
+        if (bucket_empty_status[bucket]) {
+            g1::conditional_negate_affine(points + (entry >> 32ULL), buckets + bucket, (entry >> 31ULL) & 1ULL);
+            bucket_empty_status[bucket] = false;
+            return true;
+        }
+        bucket_in_batch[bucket] = 1;
+        batch[batch_size++] = entry;
+        return true;
+    };
+
+    // with `handle_edge_cases`, a point equal to its bucket is doubled and a point equal to the bucket's negation
+    // empties the bucket (and contributes nothing to the batch inversion)
+    const auto evaluate_batch = [&]() {
+        fq accumulator = fq::one();
+        g1::affine_element point;
+        for (size_t i = 0; i < batch_size; ++i) {
+            const uint64_t entry = batch[i];
+            // the conflict queue follows the batch, so `batch[i + 1]` is always readable
+            __builtin_prefetch(points + (batch[i + 1] >> 32ULL));
+            const g1::affine_element& bucket = buckets[(entry & 0x7fffffffU) - range_start];
+            const fq& point_x = points[entry >> 32ULL].x;
+            inversion_products[i] = accumulator;
+            if (handle_edge_cases && bucket.x == point_x) {
+                g1::conditional_negate_affine(points + (entry >> 32ULL), &point, (entry >> 31ULL) & 1ULL);
+                if (bucket.y == point.y) {
+                    accumulator *= (bucket.y + bucket.y);
+                }
+                continue;
+            }
+            accumulator *= (point_x - bucket.x);
+        }
+        if (accumulator == 0) {
+            throw_or_abort("attempted to invert zero in evaluate_round_affine_buckets");
+        }
+        accumulator = accumulator.invert();
 
-            const uint64_t num_round_points = state.round_counts[i];
+        for (size_t i = batch_size - 1; i < batch_size; --i) {
+            const uint64_t entry = batch[i];
+            if (i > 0) {
+                __builtin_prefetch(points + (batch[i - 1] >> 32ULL));
+                __builtin_prefetch(buckets + ((batch[i - 1] & 0x7fffffffU) - range_start));
+            }
+            const size_t bucket_index = (entry & 0x7fffffffU) - range_start;
+            g1::affine_element& bucket = buckets[bucket_index];
+            g1::conditional_negate_affine(points + (entry >> 32ULL), &point, (entry >> 31ULL) & 1ULL);
+            bucket_in_batch[bucket_index] = 0;
+
+            fq lambda;
+            if (handle_edge_cases && bucket.x == point.x) {
+                if (bucket.y != point.y) {
+                    bucket_empty_status[bucket_index] = true;
+                    continue;
+                }
+                lambda = accumulator * inversion_products[i];
+                accumulator *= (bucket.y + bucket.y);
+                const fq x_squared = bucket.x.sqr();
+                lambda *= (x_squared + x_squared + x_squared);
+            } else {
+                lambda = accumulator * inversion_products[i];
+                accumulator *= (point.x - bucket.x);
+                lambda *= (point.y - bucket.y);
+            }
+            const fq x_3 = lambda.sqr() - bucket.x - point.x;
+            bucket.y = lambda * (bucket.x - x_3) - bucket.y;
+            bucket.x = x_3;
+        }
+        batch_size = 0;
+    };
 
-            g1::element accumulator;
-            accumulator.self_set_infinity();
+    // the batch is empty after evaluation, so at least the first queued entry leaves the queue
+    const auto evaluate_batch_and_retry_queue = [&]() {
+        if (batch_size > 0) {
+            evaluate_batch();
+        }
+        size_t num_remaining = 0;
+        for (size_t i = 0; i < queue_size; ++i) {
+            if (!try_add_entry(queue[i])) {
+                queue[num_remaining++] = queue[i];
+            }
+        }
+        queue_size = num_remaining;
+    };
 
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
+    for (size_t i = 0; i < num_schedule_entries; ++i) {
+        const uint64_t entry = round_schedule[i];
+        const size_t bucket = entry & 0x7fffffffU;
+        if (entry == 0xffffffffffffffffULL || bucket < range_start || bucket >= range_end) {
+            continue;
+        }
+        if (handle_edge_cases && points[entry >> 32ULL].is_point_at_infinity()) {
+            continue;
+        }
+        if (!try_add_entry(entry)) {
+            queue[queue_size++] = entry;
+        }
+        while (batch_size == max_batch_size || queue_size == max_batch_size) {
+            evaluate_batch_and_retry_queue();
+        }
+    }
+    while (batch_size > 0 || queue_size > 0) {
+        evaluate_batch_and_retry_queue();
+    }
 
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
-
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
-
-                affine_product_runtime_state product_state = state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points;
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                g1::affine_element* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                g1::element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
-                    }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    uint32_t multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    g1::element rolling_accumulator = g1::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
+    // compact the non-empty buckets to the front of the bucket array, the layout `reduce_buckets` produces
+    size_t num_output_buckets = 0;
+    size_t first_bucket = 0;
+    size_t last_bucket = 0;
+    for (size_t k = 0; k < num_range_buckets; ++k) {
+        if (!bucket_empty_status[k]) {
+            if (num_output_buckets == 0) {
+                first_bucket = k;
+            }
+            last_bucket = k;
+            buckets[num_output_buckets++] = buckets[k];
+        }
+    }
+    if (num_output_buckets == 0) {
+        return;
+    }
+    concatenate_buckets(buckets,
+                        num_output_buckets,
+                        bucket_empty_status + first_bucket,
+                        range_start + first_bucket,
+                        range_start + last_bucket,
+                        bits_per_bucket,
+                        msm_accumulators);
+}
+} // namespace
+
+BucketStrategy select_bucket_strategy(const BucketStrategy strategy, const size_t num_initial_points)
+{
+    if (strategy != AUTO_BUCKETS) {
+        return strategy;
+    }
+    const bool use_affine_buckets =
+        num_initial_points >= AFFINE_BUCKETS_MIN_POINTS && num_initial_points <= AFFINE_BUCKETS_MAX_POINTS;
+    return use_affine_buckets ? AFFINE_BUCKETS : SORTED_BUCKETS;
+}
+
+/**
+ * Evaluate the pippenger rounds of `num_msms` MSMs that share the same point table.
+ *
+ * With a single MSM, a thread's tranche of the (sorted) round schedule covers a contiguous range of buckets.
+ * With a batch, that range can span several MSMs. The thread's points are still added into buckets in one pass (with
+ * one set of batched affine additions), and the bucket concatenation is then split at each MSM boundary.
+ **/
+void evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                               g1::affine_element* points,
+                               const size_t num_points,
+                               const size_t num_msms,
+                               g1::element* results,
+                               bool handle_edge_cases,
+                               const BucketStrategy strategy)
+{
+    const size_t num_rounds = get_calibrated_num_rounds(num_points);
+    const size_t num_threads = state.num_threads;
+    const size_t bits_per_bucket = get_calibrated_bucket_width(num_points / 2);
+    const size_t schedule_stride = num_points * num_msms;
+
+    g1::element* thread_accumulators = state.thread_accumulators;
+
+    parallel_for(num_threads, [&](const size_t j_start, const size_t j_end) {
+        for (size_t j = j_start; j < j_end; ++j) {
+            g1::element* msm_accumulators = &thread_accumulators[j * num_msms];
+            for (size_t m = 0; m < num_msms; ++m) {
+                msm_accumulators[m].self_set_infinity();
+            }
+
+            for (size_t i = 0; i < num_rounds; ++i) {
+                if (i > 0) {
+                    for (size_t m = 0; m < num_msms; ++m) {
+                        for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
+                            msm_accumulators[m].self_dbl();
                         }
-                        init = true;
-                        shift -= 1;
                     }
-                    accumulator += rolling_accumulator;
                 }
-            }
 
-            if (i == (num_rounds - 1)) {
-                const size_t num_points_per_thread = num_points / num_threads;
-                bool* skew_table = &state.skew_table[j * num_points_per_thread];
-                g1::affine_element* point_table = &points[j * num_points_per_thread];
-                g1::affine_element addition_temporary;
-                for (size_t k = 0; k < num_points_per_thread; ++k) {
-                    if (skew_table[k]) {
-                        addition_temporary = -point_table[k];
-                        accumulator += addition_temporary;
-                    }
+                if (strategy == AFFINE_BUCKETS) {
+                    evaluate_round_affine_buckets(state,
+                                                  points,
+                                                  &state.point_schedule[i * schedule_stride],
+                                                  schedule_stride,
+                                                  state.round_counts[i],
+                                                  num_threads,
+                                                  j,
+                                                  bits_per_bucket,
+                                                  num_msms,
+                                                  msm_accumulators,
+                                                  handle_edge_cases);
+                } else {
+                    evaluate_round_tranche(state,
+                                           points,
+                                           &state.point_schedule[i * schedule_stride],
+                                           state.round_counts[i],
+                                           num_threads,
+                                           j,
+                                           bits_per_bucket,
+                                           msm_accumulators,
+                                           handle_edge_cases);
                 }
-            }
 
-            if (i > 0) {
-                for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
-                    thread_accumulators[j].self_dbl();
+                if (i == (num_rounds - 1)) {
+                    const size_t num_points_per_thread = (num_points + num_threads - 1) / num_threads;
+                    const size_t start = std::min(j * num_points_per_thread, num_points);
+                    const size_t end = std::min(start + num_points_per_thread, num_points);
+                    g1::affine_element* point_table = &points[start];
+                    g1::affine_element addition_temporary;
+                    for (size_t m = 0; m < num_msms; ++m) {
+                        bool* skew_table = &state.skew_table[m * num_points + start];
+                        for (size_t k = 0; k < end - start; ++k) {
+                            if (skew_table[k]) {
+                                addition_temporary = -point_table[k];
+                                msm_accumulators[m] += addition_temporary;
+                            }
+                        }
+                    }
                 }
             }
-            thread_accumulators[j] += accumulator;
+        }
+    });
+
+    for (size_t m = 0; m < num_msms; ++m) {
+        results[m].self_set_infinity();
+        for (size_t i = 0; i < num_threads; ++i) {
+            results[m] += thread_accumulators[i * num_msms + m];
         }
     }
+}
 
+g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                                      g1::affine_element* points,
+                                      const size_t num_points,
+                                      bool handle_edge_cases,
+                                      const BucketStrategy strategy)
+{
     g1::element result;
-    result.self_set_infinity();
-    for (size_t i = 0; i < num_threads; ++i) {
-        result += thread_accumulators[i];
-    }
+    evaluate_pippenger_rounds(state, points, num_points, 1, &result, handle_edge_cases, strategy);
     return result;
 }
 
@@ -850,26 +1210,29 @@ g1::element pippenger_internal(g1::affine_element* points,
                                bool handle_edge_cases)
 {
     // multiplication_runtime_state state;
+    const BucketStrategy strategy = select_bucket_strategy(state.bucket_strategy, num_initial_points);
     compute_wnaf_states(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
-    organize_buckets(state.point_schedule, state.round_counts, num_initial_points * 2);
-    g1::element result = evaluate_pippenger_rounds(state, points, num_initial_points * 2, handle_edge_cases);
+    // affine buckets consume the round schedule in point order
+    if (strategy == SORTED_BUCKETS) {
+        organize_buckets(state.point_schedule, state.round_counts, num_initial_points * 2);
+    }
+    g1::element result = evaluate_pippenger_rounds(state, points, num_initial_points * 2, handle_edge_cases, strategy);
     return result;
 }
 
-g1::element pippenger(fr* scalars,
-                      g1::affine_element* points,
-                      const size_t num_initial_points,
-                      pippenger_runtime_state& state,
-                      bool handle_edge_cases)
+/**
+ * The regular pippenger algorithm, without the sparse-scalar pre-pass of `pippenger`.
+ **/
+g1::element pippenger_dense(fr* scalars,
+                            g1::affine_element* points,
+                            const size_t num_initial_points,
+                            pippenger_runtime_state& state,
+                            bool handle_edge_cases)
 {
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
     // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
     // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms Pippenger
-#ifndef NO_MULTITHREADING
-    const size_t threshold = std::max(max_threads::compute_num_threads() * 8, 8UL);
-#else
-    const size_t threshold = 8UL;
-#endif
+    const size_t threshold = std::max(state.num_threads * 8, 8UL);
 
     if (num_initial_points == 0) {
         g1::element out = g1::one;
@@ -881,12 +1244,11 @@ g1::element pippenger(fr* scalars,
         std::vector<g1::element> exponentiation_results(num_initial_points);
         // might as well multithread this...
         // Possible optimization: use group::batch_mul_with_endomorphism here.
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t i = 0; i < num_initial_points; ++i) {
-            exponentiation_results[i] = g1::element(points[i * 2]) * scalars[i];
-        }
+        parallel_for(num_initial_points, [&](const size_t i_start, const size_t i_end) {
+            for (size_t i = i_start; i < i_end; ++i) {
+                exponentiation_results[i] = g1::element(points[i * 2]) * scalars[i];
+            }
+        });
 
         for (size_t i = num_initial_points - 1; i > 0; --i) {
             exponentiation_results[i - 1] += exponentiation_results[i];
@@ -901,16 +1263,616 @@ g1::element pippenger(fr* scalars,
 
     if (num_slice_points != num_initial_points) {
         const uint64_t leftover_points = num_initial_points - num_slice_points;
-        return result + pippenger(scalars + num_slice_points,
-                                  points + static_cast<size_t>(num_slice_points * 2),
-                                  static_cast<size_t>(leftover_points),
-                                  state,
-                                  handle_edge_cases);
+        return result + pippenger_dense(scalars + num_slice_points,
+                                        points + static_cast<size_t>(num_slice_points * 2),
+                                        static_cast<size_t>(leftover_points),
+                                        state,
+                                        handle_edge_cases);
     } else {
         return result;
     }
 }
 
+namespace {
+enum ScalarClass : uint8_t { ZERO_SCALAR, ONE_SCALAR, SMALL_SCALAR, LARGE_SCALAR };
+
+ScalarClass classify_scalar(const fr& scalar)
+{
+    if (scalar.is_zero()) {
+        return ZERO_SCALAR;
+    }
+    if (scalar == fr::one()) {
+        return ONE_SCALAR;
+    }
+    const fr converted = scalar.from_montgomery_form();
+    if ((converted.data[1] | converted.data[2] | converted.data[3]) == 0 &&
+        (converted.data[0] >> SMALL_SCALAR_BITS) == 0) {
+        return SMALL_SCALAR;
+    }
+    return LARGE_SCALAR;
+}
+
+void increment_histogram(scalar_histogram& histogram, const ScalarClass scalar_class)
+{
+    switch (scalar_class) {
+    case ZERO_SCALAR: {
+        ++histogram.num_zero;
+        break;
+    }
+    case ONE_SCALAR: {
+        ++histogram.num_one;
+        break;
+    }
+    case SMALL_SCALAR: {
+        ++histogram.num_small;
+        break;
+    }
+    default: {
+        ++histogram.num_large;
+    }
+    }
+}
+
+/**
+ * Sum `num_points` affine points with a tree of batched affine additions (see `add_affine_points`).
+ * Overwrites `points`. `scratch_space` must hold `num_points / 2` field elements.
+ **/
+g1::element sum_affine_points(g1::affine_element* points,
+                              size_t num_points,
+                              fq* scratch_space,
+                              bool handle_edge_cases)
+{
+    g1::element result;
+    result.self_set_infinity();
+    while (num_points > 1) {
+        if (num_points & 1) {
+            result += points[num_points - 1];
+            --num_points;
+        }
+        // the sum of each pair of points is written into the upper half of the array
+        if (handle_edge_cases) {
+            add_affine_points_with_edge_cases(points, num_points, scratch_space);
+        } else {
+            add_affine_points(points, num_points, scratch_space);
+        }
+        points += num_points / 2;
+        num_points /= 2;
+    }
+    if (num_points == 1) {
+        result += points[0];
+    }
+    return result;
+}
+} // namespace
+
+scalar_histogram compute_scalar_histogram(const fr* scalars, const size_t num_initial_points)
+{
+    const size_t num_threads = get_num_threads();
+    const size_t num_points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    std::vector<scalar_histogram> thread_histograms(num_threads);
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t start = std::min(i * num_points_per_thread, num_initial_points);
+            const size_t end = std::min(start + num_points_per_thread, num_initial_points);
+            for (size_t j = start; j < end; ++j) {
+                increment_histogram(thread_histograms[i], classify_scalar(scalars[j]));
+            }
+        }
+    });
+    scalar_histogram histogram;
+    for (const auto& thread_histogram : thread_histograms) {
+        histogram += thread_histogram;
+    }
+    return histogram;
+}
+
+bool is_sparse_msm(const scalar_histogram& histogram)
+{
+    const size_t num_sparse = histogram.num_zero + histogram.num_one + histogram.num_small;
+    const size_t num_scalars = num_sparse + histogram.num_large;
+    return num_sparse > 0 && num_sparse * SPARSE_MSM_DENOMINATOR >= num_scalars;
+}
+
+/**
+ * Evaluate an MSM whose scalars are dominated by zeros, ones and small values.
+ *
+ * Zero scalars are dropped. The points of unit scalars are summed with batched affine additions. The small and large
+ * scalars (with their point pairs) are gathered into two compact MSMs: the wnaf digits of a small scalar only populate
+ * the lowest `SMALL_SCALAR_BITS / wnaf_bits` rounds (and none of its endomorphism half), so the small MSM skips the
+ * sorting and bucket accumulation of every other round. The classes and the gathered MSMs live in the sparse buffers of
+ * `state`, which are sized for its number of points when it is constructed.
+ **/
+g1::element pippenger_sparse(fr* scalars,
+                             g1::affine_element* points,
+                             const size_t num_initial_points,
+                             pippenger_runtime_state& state,
+                             bool handle_edge_cases)
+{
+    const size_t num_threads = state.num_threads;
+    const size_t num_points_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+    ASSERT(static_cast<size_t>(state.num_points) >= num_initial_points * 2);
+
+    // classify the scalars, counting each class per thread so that every thread knows where to write its share
+    uint8_t* scalar_classes = state.sparse_scalar_classes;
+    std::vector<scalar_histogram> thread_histograms(num_threads);
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t start = std::min(i * num_points_per_thread, num_initial_points);
+            const size_t end = std::min(start + num_points_per_thread, num_initial_points);
+            for (size_t j = start; j < end; ++j) {
+                const ScalarClass scalar_class = classify_scalar(scalars[j]);
+                scalar_classes[j] = scalar_class;
+                increment_histogram(thread_histograms[i], scalar_class);
+            }
+        }
+    });
+    scalar_histogram histogram;
+    for (const auto& thread_histogram : thread_histograms) {
+        histogram += thread_histogram;
+    }
+    const size_t num_large = histogram.num_large;
+    const size_t num_small = histogram.num_small;
+    const size_t num_one = histogram.num_one;
+
+    // large scalars, then small scalars. The point table holds the point pairs of each, followed by the unit points
+    fr* gathered_scalars = state.sparse_scalars;
+    g1::affine_element* gathered_points = state.sparse_points;
+    g1::affine_element* unit_points = &gathered_points[(num_large + num_small) * 2];
+
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            size_t large_it = 0;
+            size_t small_it = num_large;
+            size_t one_it = 0;
+            for (size_t j = 0; j < i; ++j) {
+                large_it += thread_histograms[j].num_large;
+                small_it += thread_histograms[j].num_small;
+                one_it += thread_histograms[j].num_one;
+            }
+            const size_t start = std::min(i * num_points_per_thread, num_initial_points);
+            const size_t end = std::min(start + num_points_per_thread, num_initial_points);
+            for (size_t j = start; j < end; ++j) {
+                switch (scalar_classes[j]) {
+                case ONE_SCALAR: {
+                    unit_points[one_it++] = points[j * 2];
+                    break;
+                }
+                case SMALL_SCALAR: {
+                    gathered_scalars[small_it] = scalars[j];
+                    gathered_points[small_it * 2] = points[j * 2];
+                    gathered_points[small_it * 2 + 1] = points[j * 2 + 1];
+                    ++small_it;
+                    break;
+                }
+                case LARGE_SCALAR: {
+                    gathered_scalars[large_it] = scalars[j];
+                    gathered_points[large_it * 2] = points[j * 2];
+                    gathered_points[large_it * 2 + 1] = points[j * 2 + 1];
+                    ++large_it;
+                    break;
+                }
+                default: {
+                }
+                }
+            }
+        }
+    });
+
+    // each thread sums its share of the unit points
+    const size_t num_unit_points_per_thread = (num_one + num_threads - 1) / num_threads;
+    g1::element* thread_accumulators = state.thread_accumulators;
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t start = std::min(i * num_unit_points_per_thread, num_one);
+            const size_t end = std::min(start + num_unit_points_per_thread, num_one);
+            thread_accumulators[i] = sum_affine_points(&unit_points[start],
+                                                       end - start,
+                                                       &state.scratch_space[i * num_unit_points_per_thread],
+                                                       handle_edge_cases);
+        }
+    });
+    g1::element result;
+    result.self_set_infinity();
+    for (size_t i = 0; i < num_threads; ++i) {
+        result += thread_accumulators[i];
+    }
+
+    result += pippenger_dense(gathered_scalars, gathered_points, num_large, state, handle_edge_cases);
+    result += pippenger_dense(
+        &gathered_scalars[num_large], &gathered_points[num_large * 2], num_small, state, handle_edge_cases);
+    return result;
+}
+
+/**
+ * Compute the MSM of `scalars` against the pippenger point table `points`.
+ *
+ * A pre-pass builds a histogram of the scalars (stored in `state.last_scalar_histogram`). MSMs dominated by zero, unit
+ * and small scalars, such as selector polynomials and padded witness polynomials, take the sparse path.
+ **/
+g1::element pippenger(fr* scalars,
+                      g1::affine_element* points,
+                      const size_t num_initial_points,
+                      pippenger_runtime_state& state,
+                      bool handle_edge_cases)
+{
+    state.last_scalar_histogram = compute_scalar_histogram(scalars, num_initial_points);
+    const size_t threshold = std::max(state.num_threads * 8, 8UL);
+    if (num_initial_points > threshold && is_sparse_msm(state.last_scalar_histogram)) {
+        return pippenger_sparse(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+    return pippenger_dense(scalars, points, num_initial_points, state, handle_edge_cases);
+}
+
+/**
+ * Evaluate a batch of MSMs over the same power-of-two number of points.
+ * The wnaf entries of every MSM are written into one point schedule, so every round reduces the buckets of the whole
+ * batch together: one pass of batched affine additions per thread per round, instead of one per MSM.
+ **/
+void pippenger_batch_internal(g1::affine_element* points,
+                              const std::vector<fr*>& scalars,
+                              const size_t num_initial_points,
+                              pippenger_runtime_state& state,
+                              g1::element* results,
+                              bool handle_edge_cases)
+{
+    const size_t num_msms = scalars.size();
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_rounds = get_calibrated_num_rounds(num_points);
+
+    for (size_t i = 0; i < num_msms; ++i) {
+        compute_wnaf_states(state.point_schedule,
+                            state.skew_table,
+                            &state.round_counts[MAX_NUM_ROUNDS * (i + 1)],
+                            scalars[i],
+                            num_initial_points,
+                            num_msms,
+                            i);
+    }
+    for (size_t i = 0; i < num_rounds; ++i) {
+        state.round_counts[i] = 0;
+        for (size_t j = 0; j < num_msms; ++j) {
+            state.round_counts[i] += state.round_counts[MAX_NUM_ROUNDS * (j + 1) + i];
+        }
+    }
+    const BucketStrategy strategy = select_bucket_strategy(state.bucket_strategy, num_initial_points);
+    if (strategy == SORTED_BUCKETS) {
+        organize_buckets(state.point_schedule, state.round_counts, num_points, num_msms);
+    }
+    evaluate_pippenger_rounds(state, points, num_points, num_msms, results, handle_edge_cases, strategy);
+}
+
+/**
+ * The batched pippenger algorithm, without the sparse-scalar pre-pass of `pippenger_batch`.
+ *
+ * `state` must have been constructed for at least `num_initial_points` points. If it was constructed for fewer MSMs
+ * than `scalars.size()`, the batch is split into sub-batches of `state.num_msms` MSMs.
+ **/
+std::vector<g1::element> pippenger_batch_dense(const std::vector<fr*>& scalars,
+                                               g1::affine_element* points,
+                                               const size_t num_initial_points,
+                                               pippenger_runtime_state& state,
+                                               bool handle_edge_cases)
+{
+    const size_t num_msms = scalars.size();
+    std::vector<g1::element> results(num_msms);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+    if (num_msms == 0 || num_initial_points == 0) {
+        return results;
+    }
+
+    const size_t max_batch_size = std::max(state.num_msms, 1UL);
+    if (num_msms > max_batch_size) {
+        for (size_t i = 0; i < num_msms; i += max_batch_size) {
+            const size_t batch_size = std::min(max_batch_size, num_msms - i);
+            const std::vector<fr*> batch_scalars(scalars.begin() + static_cast<std::ptrdiff_t>(i),
+                                                 scalars.begin() + static_cast<std::ptrdiff_t>(i + batch_size));
+            const auto batch_results =
+                pippenger_batch_dense(batch_scalars, points, num_initial_points, state, handle_edge_cases);
+            std::copy(batch_results.begin(), batch_results.end(), results.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        return results;
+    }
+
+    const size_t threshold = std::max(state.num_threads * 8, 8UL);
+    if (num_msms == 1 || num_initial_points <= threshold) {
+        for (size_t i = 0; i < num_msms; ++i) {
+            results[i] = pippenger_dense(scalars[i], points, num_initial_points, state, handle_edge_cases);
+        }
+        return results;
+    }
+
+    const size_t slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const size_t num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+    pippenger_batch_internal(points, scalars, num_slice_points, state, &results[0], handle_edge_cases);
+
+    if (num_slice_points != num_initial_points) {
+        std::vector<fr*> leftover_scalars(num_msms);
+        for (size_t i = 0; i < num_msms; ++i) {
+            leftover_scalars[i] = scalars[i] + num_slice_points;
+        }
+        const auto leftover_results = pippenger_batch_dense(leftover_scalars,
+                                                            points + static_cast<size_t>(num_slice_points * 2),
+                                                            num_initial_points - num_slice_points,
+                                                            state,
+                                                            handle_edge_cases);
+        for (size_t i = 0; i < num_msms; ++i) {
+            results[i] += leftover_results[i];
+        }
+    }
+    return results;
+}
+
+/**
+ * Compute a batch of MSMs, one per entry of `scalars`, against the same `points`.
+ *
+ * This is the shape of the prover's commitment rounds: several polynomials are committed to with the same SRS.
+ * Evaluating the batch together means the point table is streamed once per pippenger round rather than once per MSM.
+ * MSMs dominated by sparse scalars (see `pippenger_sparse`) are taken out of the batch and evaluated on their own.
+ **/
+std::vector<g1::element> pippenger_batch(const std::vector<fr*>& scalars,
+                                         g1::affine_element* points,
+                                         const size_t num_initial_points,
+                                         pippenger_runtime_state& state,
+                                         bool handle_edge_cases)
+{
+    const size_t num_msms = scalars.size();
+    std::vector<g1::element> results(num_msms);
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+    if (num_msms == 0 || num_initial_points == 0) {
+        return results;
+    }
+
+    const size_t threshold = std::max(state.num_threads * 8, 8UL);
+    scalar_histogram batch_histogram;
+    std::vector<fr*> dense_scalars;
+    std::vector<size_t> dense_indices;
+    for (size_t i = 0; i < num_msms; ++i) {
+        const scalar_histogram histogram = compute_scalar_histogram(scalars[i], num_initial_points);
+        batch_histogram += histogram;
+        if (num_initial_points > threshold && is_sparse_msm(histogram)) {
+            results[i] = pippenger_sparse(scalars[i], points, num_initial_points, state, handle_edge_cases);
+        } else {
+            dense_scalars.push_back(scalars[i]);
+            dense_indices.push_back(i);
+        }
+    }
+
+    const auto dense_results =
+        pippenger_batch_dense(dense_scalars, points, num_initial_points, state, handle_edge_cases);
+    for (size_t i = 0; i < dense_indices.size(); ++i) {
+        results[dense_indices[i]] = dense_results[i];
+    }
+    state.last_scalar_histogram = batch_histogram;
+    return results;
+}
+
+std::vector<g1::element> pippenger_batch_unsafe(const std::vector<fr*>& scalars,
+                                                g1::affine_element* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state& state)
+{
+    return pippenger_batch(scalars, points, num_initial_points, state, false);
+}
+
+size_t get_fixed_base_table_size(const size_t num_initial_points, const size_t num_shifts)
+{
+    const size_t prefetch_overflow = 16 * get_num_threads();
+    return num_initial_points * 2 * num_shifts + prefetch_overflow;
+}
+
+size_t get_fixed_base_num_shifts(const size_t num_initial_points, const size_t memory_budget)
+{
+    const size_t num_rounds = get_calibrated_num_rounds(num_initial_points * 2);
+    const size_t base_state_size = get_runtime_state_num_bytes(num_initial_points, 1);
+    for (size_t num_shifts = num_rounds; num_shifts > 1; --num_shifts) {
+        const size_t table_size = get_fixed_base_table_size(num_initial_points, num_shifts);
+        const size_t state_size = get_runtime_state_num_bytes(num_initial_points, num_shifts) - base_state_size;
+        if (table_size * sizeof(g1::affine_element) + state_size <= memory_budget) {
+            return num_shifts;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Fill `table.points` with `table.num_shifts` copies of the pippenger point table `point_table`.
+ * Copy `s` holds every point of `point_table` multiplied by 2^(s * (bits_per_bucket + 1)), i.e. the weight of the wnaf
+ * digit `s` rounds below the most significant round of a group.
+ **/
+void generate_fixed_base_point_table(const g1::affine_element* point_table, const fixed_base_point_table& table)
+{
+    const size_t num_points = table.num_initial_points * 2;
+    const size_t wnaf_bits = table.bits_per_bucket + 1;
+    memcpy((void*)table.points, (void*)point_table, num_points * sizeof(g1::affine_element));
+    const size_t num_threads = get_num_threads();
+    const size_t num_points_per_thread = (num_points + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t start = std::min(i * num_points_per_thread, num_points);
+            const size_t end = std::min(start + num_points_per_thread, num_points);
+            std::vector<g1::element> temporaries(end - start);
+            for (size_t s = 1; s < table.num_shifts; ++s) {
+                const g1::affine_element* previous = &table.points[(s - 1) * num_points];
+                g1::affine_element* current = &table.points[s * num_points];
+                for (size_t j = start; j < end; ++j) {
+                    temporaries[j - start] = g1::element(previous[j]);
+                    for (size_t k = 0; k < wnaf_bits; ++k) {
+                        temporaries[j - start].self_dbl();
+                    }
+                }
+                g1::element::batch_normalize(&temporaries[0], end - start);
+                for (size_t j = start; j < end; ++j) {
+                    current[j] = g1::affine_element(temporaries[j - start].x, temporaries[j - start].y);
+                }
+            }
+        }
+    });
+}
+
+/**
+ * Fixed-base pippenger over a power-of-two number of points.
+ *
+ * Round `i` of the point schedule holds the wnaf digits of weight 2^(wnaf_bits * (num_rounds - 1 - i)). We fold
+ * `num_shifts` consecutive rounds into one, by pointing each digit at the copy of its point that has already been
+ * multiplied by the digit's weight relative to the least significant round of the group. Each group is a single sorted
+ * schedule over `num_shifts` times as many points, whose buckets are reduced once instead of once per round.
+ * With `num_shifts == num_rounds` there is a single bucket reduction and no doubling at all.
+ **/
+g1::element pippenger_fixed_base_internal(g1::affine_element* points,
+                                          const size_t point_stride,
+                                          const size_t num_shifts,
+                                          const size_t bits_per_bucket,
+                                          fr* scalars,
+                                          const size_t num_initial_points,
+                                          pippenger_runtime_state& state,
+                                          bool handle_edge_cases)
+{
+    const size_t num_points = num_initial_points * 2;
+    const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+    const size_t num_groups = (num_rounds + num_shifts - 1) / num_shifts;
+    const size_t num_threads = state.num_threads;
+
+    compute_wnaf_states_with_bucket_width(
+        state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points, bits_per_bucket);
+
+    // group `i` covers the contiguous rows [get_first_round(i), get_last_round(i)] of the point schedule,
+    // with group 0 holding the least significant rounds
+    const auto get_first_round = [=](const size_t group) {
+        return (num_rounds > (group + 1) * num_shifts) ? num_rounds - (group + 1) * num_shifts : 0;
+    };
+    const auto get_last_round = [=](const size_t group) { return num_rounds - 1 - group * num_shifts; };
+    uint64_t* group_counts = &state.round_counts[MAX_NUM_ROUNDS];
+
+    parallel_for(num_groups, [&](const size_t i_start, const size_t i_end) {
+        for (size_t i = i_start; i < i_end; ++i) {
+            const size_t first_round = get_first_round(i);
+            const size_t last_round = get_last_round(i);
+            group_counts[i] = 0;
+            for (size_t j = first_round; j <= last_round; ++j) {
+                const uint64_t point_offset = static_cast<uint64_t>(((num_rounds - 1 - j) % num_shifts) * point_stride)
+                                              << 32ULL;
+                uint64_t* round_schedule = &state.point_schedule[j * num_points];
+                if (point_offset != 0) {
+                    for (size_t k = 0; k < num_points; ++k) {
+                        if (round_schedule[k] != 0xffffffffffffffffULL) {
+                            round_schedule[k] += point_offset;
+                        }
+                    }
+                }
+                group_counts[i] += state.round_counts[j];
+            }
+            scalar_multiplication::process_buckets(&state.point_schedule[first_round * num_points],
+                                                   (last_round - first_round + 1) * num_points,
+                                                   static_cast<uint32_t>(wnaf_bits));
+        }
+    });
+
+    parallel_for(num_threads, [&](const size_t j_start, const size_t j_end) {
+        for (size_t j = j_start; j < j_end; ++j) {
+            g1::element& accumulator = state.thread_accumulators[j];
+            accumulator.self_set_infinity();
+            for (size_t i = num_groups; i > 0; --i) {
+                if (i != num_groups) {
+                    for (size_t k = 0; k < wnaf_bits * num_shifts; ++k) {
+                        accumulator.self_dbl();
+                    }
+                }
+                evaluate_round_tranche(state,
+                                       points,
+                                       &state.point_schedule[get_first_round(i - 1) * num_points],
+                                       group_counts[i - 1],
+                                       num_threads,
+                                       j,
+                                       bits_per_bucket,
+                                       &accumulator,
+                                       handle_edge_cases);
+            }
+
+            const size_t num_points_per_thread = (num_points + num_threads - 1) / num_threads;
+            const size_t start = std::min(j * num_points_per_thread, num_points);
+            const size_t end = std::min(start + num_points_per_thread, num_points);
+            g1::affine_element* point_table = &points[start];
+            bool* skew_table = &state.skew_table[start];
+            g1::affine_element addition_temporary;
+            for (size_t k = 0; k < end - start; ++k) {
+                if (skew_table[k]) {
+                    addition_temporary = -point_table[k];
+                    accumulator += addition_temporary;
+                }
+            }
+        }
+    });
+
+    g1::element result;
+    result.self_set_infinity();
+    for (size_t i = 0; i < num_threads; ++i) {
+        result += state.thread_accumulators[i];
+    }
+    return result;
+}
+
+/**
+ * Compute the MSM of `scalars` against points `[first_point, first_point + num_initial_points)` of a fixed-base point
+ * table (see `generate_fixed_base_point_table`).
+ *
+ * `state` must have been constructed for at least `table.num_initial_points` points and `table.num_shifts` MSMs: each
+ * thread's tranche of a round group holds up to `num_shifts` times as many points as a regular round.
+ **/
+g1::element pippenger_fixed_base(fr* scalars,
+                                 const fixed_base_point_table& table,
+                                 const size_t first_point,
+                                 const size_t num_initial_points,
+                                 pippenger_runtime_state& state,
+                                 bool handle_edge_cases)
+{
+    ASSERT(first_point + num_initial_points <= table.num_initial_points);
+    ASSERT(static_cast<size_t>(state.num_points) >= table.num_initial_points * 2);
+    ASSERT(state.num_msms >= table.num_shifts);
+    const size_t threshold = std::max(state.num_threads * 8, 8UL);
+    g1::affine_element* points = &table.points[first_point * 2];
+
+    if (num_initial_points <= threshold) {
+        return pippenger(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+
+    const size_t slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const size_t num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+    g1::element result = pippenger_fixed_base_internal(points,
+                                                       table.num_initial_points * 2,
+                                                       table.num_shifts,
+                                                       table.bits_per_bucket,
+                                                       scalars,
+                                                       num_slice_points,
+                                                       state,
+                                                       handle_edge_cases);
+
+    if (num_slice_points != num_initial_points) {
+        return result + pippenger_fixed_base(scalars + num_slice_points,
+                                             table,
+                                             first_point + num_slice_points,
+                                             num_initial_points - num_slice_points,
+                                             state,
+                                             handle_edge_cases);
+    }
+    return result;
+}
+
+g1::element pippenger_fixed_base_unsafe(fr* scalars,
+                                        const fixed_base_point_table& table,
+                                        const size_t first_point,
+                                        const size_t num_initial_points,
+                                        pippenger_runtime_state& state)
+{
+    return pippenger_fixed_base(scalars, table, first_point, num_initial_points, state, false);
+}
+
 /**
  * It's pippenger! But this one has go-faster stripes and a prediliction for questionable life choices.
  * We use affine-addition formula in this method, which paradoxically is ~45% faster than the mixed addition formulae.
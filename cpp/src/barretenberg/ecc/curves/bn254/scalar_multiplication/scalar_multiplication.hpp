@@ -5,6 +5,7 @@
 #include "./runtime_states.hpp"
 #include <stddef.h>
 #include <stdint.h>
+#include <vector>
 
 namespace barretenberg {
 namespace scalar_multiplication {
@@ -89,11 +90,25 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          bool* input_skew_table,
                          uint64_t* round_counts,
                          const fr* scalars,
-                         const size_t num_initial_points);
+                         const size_t num_initial_points,
+                         const size_t num_msms = 1,
+                         const size_t msm_index = 0);
+
+void compute_wnaf_states_with_bucket_width(uint64_t* point_schedule,
+                                           bool* input_skew_table,
+                                           uint64_t* round_counts,
+                                           const fr* scalars,
+                                           const size_t num_initial_points,
+                                           const size_t bits_per_bucket,
+                                           const size_t num_msms = 1,
+                                           const size_t msm_index = 0);
 
 void generate_pippenger_point_table(g1::affine_element* points, g1::affine_element* table, size_t num_points);
 
-void organize_buckets(uint64_t* point_schedule, const uint64_t* round_counts, const size_t num_points);
+void organize_buckets(uint64_t* point_schedule,
+                      const uint64_t* round_counts,
+                      const size_t num_points,
+                      const size_t num_msms = 1);
 
 inline void count_bits(uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
@@ -127,15 +142,55 @@ g1::element pippenger_internal(g1::affine_element* points,
                                pippenger_runtime_state& state,
                                bool handle_edge_cases);
 
+// number of independent additions that share one field inversion in `AFFINE_BUCKETS` mode
+constexpr size_t AFFINE_BUCKETS_BATCH_SIZE = 1024;
+// `AUTO_BUCKETS` evaluates MSMs of between these many points (before the endomorphism split) with `AFFINE_BUCKETS`
+// (see the bucket strategy sweep of pippenger_bench). Below, there are too few buckets to fill a batch without
+// conflicts. Above, the sorted schedule's sequential bucket access wins.
+constexpr size_t AFFINE_BUCKETS_MIN_POINTS = 1UL << 14;
+constexpr size_t AFFINE_BUCKETS_MAX_POINTS = 1UL << 15;
+
+BucketStrategy select_bucket_strategy(const BucketStrategy strategy, const size_t num_initial_points);
+
 g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
                                       g1::affine_element* points,
                                       const size_t num_points,
-                                      bool handle_edge_cases = false);
+                                      bool handle_edge_cases = false,
+                                      const BucketStrategy strategy = SORTED_BUCKETS);
+
+void evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                               g1::affine_element* points,
+                               const size_t num_points,
+                               const size_t num_msms,
+                               g1::element* results,
+                               bool handle_edge_cases = false,
+                               const BucketStrategy strategy = SORTED_BUCKETS);
 
 g1::affine_element* reduce_buckets(affine_product_runtime_state& state,
                                    bool first_round = true,
                                    bool handle_edge_cases = false);
 
+// scalars below 2^SMALL_SCALAR_BITS are evaluated in their own MSM by the sparse-scalar path
+constexpr size_t SMALL_SCALAR_BITS = 32;
+// an MSM takes the sparse-scalar path if at least 1 / SPARSE_MSM_DENOMINATOR of its scalars are zero, one or small
+constexpr size_t SPARSE_MSM_DENOMINATOR = 4;
+
+scalar_histogram compute_scalar_histogram(const fr* scalars, const size_t num_initial_points);
+
+bool is_sparse_msm(const scalar_histogram& histogram);
+
+g1::element pippenger_dense(fr* scalars,
+                            g1::affine_element* points,
+                            const size_t num_initial_points,
+                            pippenger_runtime_state& state,
+                            bool handle_edge_cases = true);
+
+g1::element pippenger_sparse(fr* scalars,
+                             g1::affine_element* points,
+                             const size_t num_initial_points,
+                             pippenger_runtime_state& state,
+                             bool handle_edge_cases = true);
+
 g1::element pippenger(fr* scalars,
                       g1::affine_element* points,
                       const size_t num_points,
@@ -146,6 +201,73 @@ g1::element pippenger_unsafe(fr* scalars,
                              g1::affine_element* points,
                              const size_t num_initial_points,
                              pippenger_runtime_state& state);
+
+void pippenger_batch_internal(g1::affine_element* points,
+                              const std::vector<fr*>& scalars,
+                              const size_t num_initial_points,
+                              pippenger_runtime_state& state,
+                              g1::element* results,
+                              bool handle_edge_cases);
+
+std::vector<g1::element> pippenger_batch_dense(const std::vector<fr*>& scalars,
+                                               g1::affine_element* points,
+                                               const size_t num_initial_points,
+                                               pippenger_runtime_state& state,
+                                               bool handle_edge_cases = true);
+
+std::vector<g1::element> pippenger_batch(const std::vector<fr*>& scalars,
+                                         g1::affine_element* points,
+                                         const size_t num_initial_points,
+                                         pippenger_runtime_state& state,
+                                         bool handle_edge_cases = true);
+
+std::vector<g1::element> pippenger_batch_unsafe(const std::vector<fr*>& scalars,
+                                                g1::affine_element* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state& state);
+
+/**
+ * A fixed-base point table: `num_shifts` consecutive copies of the pippenger point table of `num_initial_points`
+ * points, where copy `s` holds every point multiplied by 2^(s * (bits_per_bucket + 1)).
+ **/
+struct fixed_base_point_table {
+    g1::affine_element* points;
+    size_t num_initial_points;
+    size_t num_shifts;
+    size_t bits_per_bucket;
+};
+
+// the number of affine elements to allocate for a fixed-base point table
+size_t get_fixed_base_table_size(const size_t num_initial_points, const size_t num_shifts);
+
+// the largest number of shifts whose point table and extra runtime state memory fit in `memory_budget` bytes.
+// returns 1 (fixed-base mode is pointless) if not even 2 shifts fit.
+size_t get_fixed_base_num_shifts(const size_t num_initial_points, const size_t memory_budget);
+
+void generate_fixed_base_point_table(const g1::affine_element* point_table, const fixed_base_point_table& table);
+
+g1::element pippenger_fixed_base_internal(g1::affine_element* points,
+                                          const size_t point_stride,
+                                          const size_t num_shifts,
+                                          const size_t bits_per_bucket,
+                                          fr* scalars,
+                                          const size_t num_initial_points,
+                                          pippenger_runtime_state& state,
+                                          bool handle_edge_cases);
+
+g1::element pippenger_fixed_base(fr* scalars,
+                                 const fixed_base_point_table& table,
+                                 const size_t first_point,
+                                 const size_t num_initial_points,
+                                 pippenger_runtime_state& state,
+                                 bool handle_edge_cases = true);
+
+g1::element pippenger_fixed_base_unsafe(fr* scalars,
+                                        const fixed_base_point_table& table,
+                                        const size_t first_point,
+                                        const size_t num_initial_points,
+                                        pippenger_runtime_state& state);
+
 g1::element pippenger_without_endomorphism_basis_points(fr* scalars,
                                                         g1::affine_element* points,
                                                         const size_t num_initial_points,
@@ -1,8 +1,13 @@
 #include "pippenger.hpp"
 #include "scalar_multiplication.hpp"
+#include "runtime_state_pool.hpp"
+#include "bucket_width_table.hpp"
+#include "point_table_cache.hpp"
 #include <chrono>
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/srs/io.hpp"
+#include <cstdio>
+#include <filesystem>
 #include <vector>
 
 #include "barretenberg/numeric/random/engine.hpp"
@@ -935,3 +940,576 @@ TEST(scalar_multiplication, pippenger_mul_by_zero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TEST(scalar_multiplication, runtime_state_pool)
+{
+    constexpr size_t num_points = 1024;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        g1::element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    scalar_multiplication::RuntimeStatePool pool(num_points);
+    g1::element first_result = pool.pippenger_unsafe(scalars, points, num_points);
+    EXPECT_EQ(pool.get_stats().num_allocations, 1UL);
+
+    // subsequent MSMs (of equal or smaller size) reuse the pooled state
+    g1::element second_result = pool.pippenger(scalars, points, num_points);
+    g1::element smaller_result = pool.pippenger_unsafe(scalars, points, num_points / 2);
+    EXPECT_EQ(pool.get_stats().num_allocations, 1UL);
+    EXPECT_EQ(pool.get_stats().num_checkouts, 3UL);
+    EXPECT_EQ(pool.get_stats().num_idle_states, 1UL);
+
+    // a second concurrent checkout needs its own state
+    {
+        auto state_a = pool.checkout(num_points);
+        auto state_b = pool.checkout(num_points);
+        EXPECT_NE(&(*state_a), &(*state_b));
+    }
+    EXPECT_EQ(pool.get_stats().num_allocations, 2UL);
+    EXPECT_EQ(pool.get_stats().num_idle_states, 2UL);
+
+    g1::element expected_smaller;
+    expected_smaller.self_set_infinity();
+    for (size_t i = 0; i < num_points / 2; ++i) {
+        expected_smaller += points[i * 2] * scalars[i];
+    }
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(first_result.normalize() == expected, true);
+    EXPECT_EQ(second_result.normalize() == expected, true);
+    EXPECT_EQ(smaller_result.normalize() == expected_smaller.normalize(), true);
+}
+
+TEST(scalar_multiplication, pippenger_batch)
+{
+    // not a power of two, so the batch is split into a 2^k slice and a leftover
+    constexpr size_t num_points = 1000;
+    constexpr size_t num_msms = 5;
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    std::vector<fr*> scalars(num_msms);
+    for (size_t j = 0; j < num_msms; ++j) {
+        scalars[j] = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[j][i] = fr::random_element();
+        }
+    }
+    // the last MSM is all zeroes
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[num_msms - 1][i] = fr::zero();
+    }
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+
+    std::vector<g1::element> expected(num_msms);
+    for (size_t j = 0; j < num_msms; ++j) {
+        expected[j].self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected[j] += points[i] * scalars[j][i];
+        }
+        expected[j] = expected[j].normalize();
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    // a state sized for the whole batch
+    scalar_multiplication::pippenger_runtime_state state(num_points, num_msms);
+    const auto results = scalar_multiplication::pippenger_batch(scalars, points, num_points, state);
+    const auto unsafe_results = scalar_multiplication::pippenger_batch_unsafe(scalars, points, num_points, state);
+
+    // a state sized for fewer MSMs than the batch contains splits the batch into chunks
+    scalar_multiplication::pippenger_runtime_state small_state(num_points, 2);
+    const auto chunked_results = scalar_multiplication::pippenger_batch(scalars, points, num_points, small_state);
+
+    scalar_multiplication::RuntimeStatePool pool(num_points);
+    const auto pooled_results = pool.pippenger_batch_unsafe(scalars, points, num_points);
+
+    for (auto& scalar : scalars) {
+        aligned_free(scalar);
+    }
+    aligned_free(points);
+
+    ASSERT_EQ(results.size(), num_msms);
+    ASSERT_EQ(unsafe_results.size(), num_msms);
+    ASSERT_EQ(chunked_results.size(), num_msms);
+    ASSERT_EQ(pooled_results.size(), num_msms);
+    for (size_t j = 0; j < num_msms; ++j) {
+        EXPECT_EQ(results[j].normalize() == expected[j], true);
+        EXPECT_EQ(unsafe_results[j].normalize() == expected[j], true);
+        EXPECT_EQ(chunked_results[j].normalize() == expected[j], true);
+        EXPECT_EQ(pooled_results[j].normalize() == expected[j], true);
+    }
+    EXPECT_EQ(results[num_msms - 1].is_point_at_infinity(), true);
+}
+
+// At 376 to 2435 points the calibrated bucket width is 7, so the sort key of a row (a bucket index and one more bit) is
+// exactly one byte, and its top bit is the low bit of the MSM index. Small scalars leave empty entries in the high
+// rounds of the second MSM's rows, which must not be mistaken for entries of its top bucket
+TEST(scalar_multiplication, pippenger_batch_small_scalars)
+{
+    for (const size_t num_points : { 512UL, 1024UL, 2048UL }) {
+        g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+        std::vector<fr> dense_scalars(num_points);
+        std::vector<fr> small_scalars(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = g1::affine_element(g1::element::random_element());
+            dense_scalars[i] = fr::random_element();
+            small_scalars[i] = (i % 3 == 0) ? fr(engine.get_random_uint64()) : fr::random_element();
+        }
+        const auto compute_expected = [&](const std::vector<fr>& scalars) {
+            g1::element expected;
+            expected.self_set_infinity();
+            for (size_t i = 0; i < num_points; ++i) {
+                expected += points[i] * scalars[i];
+            }
+            return expected.normalize();
+        };
+        const g1::element expected_dense = compute_expected(dense_scalars);
+        const g1::element expected_small = compute_expected(small_scalars);
+        scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+        scalar_multiplication::pippenger_runtime_state state(num_points, 2);
+        const auto results = scalar_multiplication::pippenger_batch(
+            { &dense_scalars[0], &small_scalars[0] }, points, num_points, state);
+        EXPECT_EQ(results[0].normalize() == expected_dense, true);
+        EXPECT_EQ(results[1].normalize() == expected_small, true);
+
+        scalar_multiplication::point_table_free(points);
+    }
+}
+
+TEST(scalar_multiplication, pippenger_fixed_base)
+{
+    constexpr size_t num_points = 1024;
+    // an MSM over a non-power-of-two sub-range of the table
+    constexpr size_t first_point = 20;
+    constexpr size_t num_range_points = 1000;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    g1::element expected_range;
+    expected_range.self_set_infinity();
+    for (size_t i = 0; i < num_range_points; ++i) {
+        expected_range += points[first_point + i] * scalars[i];
+    }
+    expected_range = expected_range.normalize();
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    const size_t num_rounds = scalar_multiplication::get_num_rounds(num_points * 2);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_num_shifts(num_points, 0), 1UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_num_shifts(num_points, 1UL << 40), num_rounds);
+
+    // one shift per round (a single bucket reduction), and a shift count that leaves a partial group of rounds
+    for (const size_t num_shifts : { num_rounds, num_rounds / 2 + 1, 2UL }) {
+        scalar_multiplication::fixed_base_point_table table{
+            nullptr, num_points, num_shifts, scalar_multiplication::get_optimal_bucket_width(num_points)
+        };
+        table.points = (g1::affine_element*)aligned_alloc(
+            64, scalar_multiplication::get_fixed_base_table_size(num_points, num_shifts) * sizeof(g1::affine_element));
+        scalar_multiplication::generate_fixed_base_point_table(points, table);
+
+        scalar_multiplication::pippenger_runtime_state state(num_points, num_shifts);
+        g1::element result = scalar_multiplication::pippenger_fixed_base(scalars, table, 0, num_points, state);
+        g1::element unsafe_result =
+            scalar_multiplication::pippenger_fixed_base_unsafe(scalars, table, 0, num_points, state);
+        g1::element range_result =
+            scalar_multiplication::pippenger_fixed_base(scalars, table, first_point, num_range_points, state);
+        aligned_free(table.points);
+
+        EXPECT_EQ(result.normalize() == expected, true);
+        EXPECT_EQ(unsafe_result.normalize() == expected, true);
+        EXPECT_EQ(range_result.normalize() == expected_range, true);
+    }
+
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_sparse_scalars)
+{
+    constexpr size_t num_points = 1000;
+
+    fr* sparse_scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    fr* dense_scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+        dense_scalars[i] = fr::random_element();
+        // 40% zeros, 30% ones, 20% small and 10% large scalars
+        switch (i % 10) {
+        case 0:
+        case 1:
+        case 2:
+        case 3: {
+            sparse_scalars[i] = fr::zero();
+            break;
+        }
+        case 4:
+        case 5:
+        case 6: {
+            sparse_scalars[i] = fr::one();
+            break;
+        }
+        case 7:
+        case 8: {
+            sparse_scalars[i] = fr(engine.get_random_uint32());
+            break;
+        }
+        default: {
+            sparse_scalars[i] = fr::random_element();
+        }
+        }
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    const auto compute_expected = [&](const fr* scalars) {
+        g1::element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i * 2] * scalars[i];
+        }
+        return expected.normalize();
+    };
+
+    scalar_multiplication::pippenger_runtime_state state(num_points, 2);
+    g1::element result = scalar_multiplication::pippenger(sparse_scalars, points, num_points, state);
+    EXPECT_EQ(result.normalize() == compute_expected(sparse_scalars), true);
+    EXPECT_EQ(state.last_scalar_histogram.num_zero, 400UL);
+    EXPECT_EQ(state.last_scalar_histogram.num_one, 300UL);
+    EXPECT_EQ(state.last_scalar_histogram.num_small + state.last_scalar_histogram.num_large, 300UL);
+    EXPECT_EQ(scalar_multiplication::is_sparse_msm(state.last_scalar_histogram), true);
+
+    g1::element unsafe_result = scalar_multiplication::pippenger_unsafe(sparse_scalars, points, num_points, state);
+    EXPECT_EQ(unsafe_result.normalize() == compute_expected(sparse_scalars), true);
+
+    // a batch with one sparse and one dense MSM
+    const auto batch_results =
+        scalar_multiplication::pippenger_batch({ sparse_scalars, dense_scalars }, points, num_points, state);
+    EXPECT_EQ(batch_results[0].normalize() == compute_expected(sparse_scalars), true);
+    EXPECT_EQ(batch_results[1].normalize() == compute_expected(dense_scalars), true);
+    EXPECT_EQ(state.last_scalar_histogram.num_zero, 400UL);
+    EXPECT_EQ(state.last_scalar_histogram.num_large >= num_points, true);
+
+    // unit scalars over repeated points need the edge-case handling of the safe variant
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i * 2] = points[0];
+        points[i * 2 + 1] = points[1];
+    }
+    g1::element repeated_result = scalar_multiplication::pippenger(sparse_scalars, points, num_points, state);
+    EXPECT_EQ(repeated_result.normalize() == compute_expected(sparse_scalars), true);
+
+    aligned_free(sparse_scalars);
+    aligned_free(dense_scalars);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_bucket_strategies)
+{
+    constexpr size_t num_points = 4096;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points * 2);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+        scalars[i] = fr::random_element();
+        scalars[num_points + i] = fr::random_element();
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    const auto compute_expected = [&](const fr* msm_scalars) {
+        g1::element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i * 2] * msm_scalars[i];
+        }
+        return expected.normalize();
+    };
+    const g1::element expected = compute_expected(scalars);
+    const g1::element expected_second = compute_expected(&scalars[num_points]);
+
+    EXPECT_EQ(scalar_multiplication::select_bucket_strategy(scalar_multiplication::AUTO_BUCKETS,
+                                                            scalar_multiplication::AFFINE_BUCKETS_MIN_POINTS),
+              scalar_multiplication::AFFINE_BUCKETS);
+    EXPECT_EQ(scalar_multiplication::select_bucket_strategy(scalar_multiplication::AUTO_BUCKETS,
+                                                            scalar_multiplication::AFFINE_BUCKETS_MAX_POINTS * 2),
+              scalar_multiplication::SORTED_BUCKETS);
+    EXPECT_EQ(scalar_multiplication::select_bucket_strategy(scalar_multiplication::SORTED_BUCKETS, num_points),
+              scalar_multiplication::SORTED_BUCKETS);
+
+    scalar_multiplication::pippenger_runtime_state state(num_points, 2);
+    for (const auto strategy : { scalar_multiplication::SORTED_BUCKETS, scalar_multiplication::AFFINE_BUCKETS }) {
+        state.bucket_strategy = strategy;
+        g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+        EXPECT_EQ(result.normalize() == expected, true);
+        g1::element unsafe_result = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, state);
+        EXPECT_EQ(unsafe_result.normalize() == expected, true);
+        const auto batch_results = scalar_multiplication::pippenger_batch(
+            { scalars, &scalars[num_points] }, points, num_points, state);
+        EXPECT_EQ(batch_results[0].normalize() == expected, true);
+        EXPECT_EQ(batch_results[1].normalize() == expected_second, true);
+    }
+
+    // repeated points and scalars make every bucket addition a doubling or a cancellation
+    const fr repeated_scalar = scalars[0];
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i * 2] = points[0];
+        points[i * 2 + 1] = points[1];
+        scalars[i] = (i & 1) ? repeated_scalar : -repeated_scalar;
+    }
+    state.bucket_strategy = scalar_multiplication::AFFINE_BUCKETS;
+    g1::element cancelling_result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+    EXPECT_EQ(cancelling_result.is_point_at_infinity(), true);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = repeated_scalar;
+    }
+    g1::element doubling_result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+    EXPECT_EQ(doubling_result.normalize() == compute_expected(scalars), true);
+
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
+// MSMs are split over every thread of the pool, so thread counts need not be powers of two. A state keeps the thread
+// count its per-thread buffers were sized for, and a pool does not hand out a state sized for a different count
+TEST(scalar_multiplication, pippenger_thread_counts)
+{
+    constexpr size_t num_points = 1000;
+    constexpr size_t num_table_points = 1024;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points * 2);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_table_points);
+    for (size_t i = 0; i < num_table_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    for (size_t i = 0; i < num_points * 2; ++i) {
+        scalars[i] = fr::random_element();
+    }
+    const auto compute_expected = [&](const fr* msm_scalars) {
+        g1::element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            expected += points[i] * msm_scalars[i];
+        }
+        return expected.normalize();
+    };
+    const g1::element expected = compute_expected(scalars);
+    const g1::element expected_second = compute_expected(&scalars[num_points]);
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_table_points);
+
+    const size_t default_num_threads = get_num_threads();
+    scalar_multiplication::RuntimeStatePool pool(num_points);
+    for (const size_t num_threads : { 3UL, 6UL, 1UL }) {
+        set_num_threads(num_threads);
+        scalar_multiplication::pippenger_runtime_state state(num_points, 2);
+        EXPECT_EQ(state.num_threads, num_threads);
+        for (const auto strategy : { scalar_multiplication::SORTED_BUCKETS, scalar_multiplication::AFFINE_BUCKETS }) {
+            state.bucket_strategy = strategy;
+            g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+            EXPECT_EQ(result.normalize() == expected, true);
+            const auto batch_results = scalar_multiplication::pippenger_batch(
+                { scalars, &scalars[num_points] }, points, num_points, state);
+            EXPECT_EQ(batch_results[0].normalize() == expected, true);
+            EXPECT_EQ(batch_results[1].normalize() == expected_second, true);
+        }
+
+        scalar_multiplication::fixed_base_point_table table{
+            nullptr, num_table_points, 2, scalar_multiplication::get_optimal_bucket_width(num_table_points)
+        };
+        table.points = (g1::affine_element*)aligned_alloc(
+            64, scalar_multiplication::get_fixed_base_table_size(num_table_points, 2) * sizeof(g1::affine_element));
+        scalar_multiplication::generate_fixed_base_point_table(points, table);
+        scalar_multiplication::pippenger_runtime_state fixed_base_state(num_table_points, 2);
+        g1::element fixed_base_result =
+            scalar_multiplication::pippenger_fixed_base(scalars, table, 0, num_points, fixed_base_state);
+        aligned_free(table.points);
+        EXPECT_EQ(fixed_base_result.normalize() == expected, true);
+
+        // the idle state of the previous thread count is replaced
+        {
+            auto pooled_state = pool.checkout(num_points);
+            EXPECT_EQ(pooled_state->num_threads, num_threads);
+        }
+
+        // a state outlives a change of thread count
+        set_num_threads(num_threads + 1);
+        g1::element stale_result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+        EXPECT_EQ(stale_result.normalize() == expected, true);
+    }
+    set_num_threads(default_num_threads);
+    EXPECT_EQ(pool.get_stats().num_allocations, 3UL);
+    EXPECT_EQ(pool.get_stats().num_idle_states, 1UL);
+
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, bucket_width_table)
+{
+    const size_t num_threads = get_num_threads();
+    // deliberately not monotonic: 2^11 points use far narrower windows than 2^10 points
+    const scalar_multiplication::bucket_width_table table{
+        { num_threads, 10, 9 }, { num_threads, 11, 3 }, { num_threads * 2, 11, 12 }, { num_threads, 12, 20 }
+    };
+    const std::string path = "bucket_width_table_test.txt";
+    EXPECT_EQ(scalar_multiplication::write_bucket_width_table(path, table), true);
+    const auto read_table = scalar_multiplication::read_bucket_width_table(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(read_table.size(), table.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+        EXPECT_EQ(read_table[i].num_threads, table[i].num_threads);
+        EXPECT_EQ(read_table[i].log_num_points, table[i].log_num_points);
+        EXPECT_EQ(read_table[i].bucket_width, table[i].bucket_width);
+    }
+    EXPECT_EQ(scalar_multiplication::read_bucket_width_table("missing_bucket_width_table.txt").empty(), true);
+
+    const auto previous_table = scalar_multiplication::get_bucket_width_table();
+    scalar_multiplication::set_bucket_width_table(read_table);
+    EXPECT_EQ(scalar_multiplication::get_calibrated_bucket_width(1 << 10), 9UL);
+    EXPECT_EQ(scalar_multiplication::get_calibrated_bucket_width((1 << 11) + 5), 3UL);
+    // never more buckets than points
+    EXPECT_EQ(scalar_multiplication::get_calibrated_bucket_width(1 << 12), 12UL);
+    EXPECT_EQ(scalar_multiplication::get_calibrated_bucket_width(1 << 13),
+              scalar_multiplication::get_optimal_bucket_width(1 << 13));
+
+    constexpr size_t num_points = (1 << 12) + 1000;
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+        scalars[i] = fr::random_element();
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[i * 2] * scalars[i];
+    }
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    EXPECT_EQ(state.max_bucket_width, 12UL);
+    for (const auto strategy : { scalar_multiplication::SORTED_BUCKETS, scalar_multiplication::AFFINE_BUCKETS }) {
+        state.bucket_strategy = strategy;
+        g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+        EXPECT_EQ(result.normalize() == expected.normalize(), true);
+    }
+
+    scalar_multiplication::set_bucket_width_table(previous_table);
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_point_table_memory_policy)
+{
+    // Huge pages and NUMA placement are requests the kernel may decline; either way the table must behave the same
+    constexpr size_t num_points = 1 << 14;
+    const memory_policy previous_policy = get_memory_policy(MemoryClass::POINT_TABLE);
+    set_memory_policy(MemoryClass::POINT_TABLE, { HugePages::EXPLICIT_2MB, NumaPlacement::INTERLEAVE, 0 });
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(points) % 64, 0UL);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+        scalars[i] = fr::random_element();
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[i * 2] * scalars[i];
+    }
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    g1::element result = scalar_multiplication::pippenger(scalars, points, num_points, state);
+    EXPECT_EQ(result.normalize() == expected.normalize(), true);
+
+    // binding to a node that does not exist falls back to interleaving
+    for (const size_t numa_node : { 64UL, 1000UL }) {
+        set_memory_policy(MemoryClass::POINT_TABLE, { HugePages::NONE, NumaPlacement::BIND, numa_node });
+        EXPECT_EQ(get_memory_policy(MemoryClass::POINT_TABLE).numa_placement == NumaPlacement::INTERLEAVE, true);
+    }
+    set_memory_policy(MemoryClass::POINT_TABLE, { HugePages::NONE, NumaPlacement::BIND, 0 });
+    EXPECT_EQ(get_memory_policy(MemoryClass::POINT_TABLE).numa_placement == NumaPlacement::BIND, true);
+
+    set_memory_policy(MemoryClass::POINT_TABLE, previous_policy);
+    aligned_free(scalars);
+    scalar_multiplication::point_table_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_point_table_cache)
+{
+    constexpr size_t num_points = 1 << 10;
+    const std::string cache_dir = (std::filesystem::temp_directory_path() / "bb_point_table_cache_test").string();
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directories(cache_dir);
+    const std::string cache_path = get_point_table_cache_path(cache_dir, BARRETENBERG_SRS_PATH);
+    ASSERT_FALSE(cache_path.empty());
+
+    const size_t table_bytes = 2 * num_points * sizeof(g1::affine_element);
+    Pippenger uncached(BARRETENBERG_SRS_PATH, num_points, "");
+
+    // the first construction writes the cache, and then uses it itself
+    {
+        Pippenger writer(BARRETENBERG_SRS_PATH, num_points, cache_dir);
+        EXPECT_TRUE(std::filesystem::exists(cache_path));
+        EXPECT_EQ(memcmp(writer.get_point_table(), uncached.get_point_table(), table_bytes), 0);
+    }
+
+    // a smaller table is served from the same file
+    {
+        Pippenger reader(BARRETENBERG_SRS_PATH, num_points / 2, cache_dir);
+        EXPECT_EQ(memcmp(reader.get_point_table(), uncached.get_point_table(), table_bytes / 2), 0);
+
+        std::vector<fr> scalars(num_points / 2);
+        g1::element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points / 2; ++i) {
+            scalars[i] = fr::random_element();
+            expected += uncached.get_point_table()[i * 2] * scalars[i];
+        }
+        g1::element result = reader.pippenger_unsafe(&scalars[0], 0, num_points / 2);
+        EXPECT_EQ(result.normalize() == expected.normalize(), true);
+    }
+
+    // a larger one rebuilds it
+    {
+        Pippenger larger(BARRETENBERG_SRS_PATH, num_points * 2, cache_dir);
+        EXPECT_EQ(memcmp(larger.get_point_table(), uncached.get_point_table(), table_bytes), 0);
+        EXPECT_EQ(std::filesystem::file_size(cache_path),
+                  (4 * num_points + POINT_TABLE_CACHE_OVERFLOW + 1) * sizeof(g1::affine_element));
+    }
+
+    // anything but a complete cache is ignored
+    std::filesystem::resize_file(cache_path, std::filesystem::file_size(cache_path) - 1);
+    EXPECT_EQ(map_point_table_cache(cache_path, num_points).points, nullptr);
+
+    std::filesystem::remove_all(cache_dir);
+}
@@ -196,6 +196,21 @@ template <class Params> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, const size_t n) noexcept;
+
+    /**
+     * Element-wise arithmetic over arrays: out[i] = a[i] * b[i], a[i] * b, a[i]^2, a[i] + b[i] and a[i] - b[i].
+     * `out` may alias `a` or `b`; other overlaps are not allowed.
+     *
+     * On CPUs with AVX-512 IFMA, products and squares are computed 8 at a time (see field_impl_ifma.hpp); elsewhere,
+     * and for moduli of more than 254 bits, these are loops over the scalar operators. Additions and subtractions are
+     * limited by memory bandwidth rather than arithmetic, and are always scalar loops.
+     **/
+    static void mul_batch(const field* a, const field* b, field* out, const size_t n) noexcept;
+    static void mul_batch(const field* a, const field& b, field* out, const size_t n) noexcept;
+    static void sqr_batch(const field* a, field* out, const size_t n) noexcept;
+    static void add_batch(const field* a, const field* b, field* out, const size_t n) noexcept;
+    static void sub_batch(const field* a, const field* b, field* out, const size_t n) noexcept;
+
     /**
      * @brief Compute square root of the field element.
      *
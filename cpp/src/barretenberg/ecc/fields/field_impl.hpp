@@ -2,6 +2,8 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
+#include <array>
 #include <span>
 #include <type_traits>
 #include <vector>
@@ -9,6 +11,7 @@
 
 #if (BBERG_NO_ASM == 0)
 #include "field_impl_x64.hpp"
+#include "field_impl_ifma.hpp"
 #endif
 
 #include "field_impl_generic.hpp"
@@ -362,6 +365,44 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     const size_t n = coeffs.size();
 
+    // Large inputs are split into `width` interleaved running products (column c multiplies the elements c, c + width,
+    // c + 2 * width, ...), so that each step multiplies a whole row of independent elements with `mul_batch` rather
+    // than waiting on a single accumulator
+    constexpr size_t width = 64;
+    if (n >= 2 * width) {
+        std::vector<field> temporaries(n);
+        std::array<field, width> accumulators;
+        std::array<field, width> row;
+        accumulators.fill(one());
+        for (size_t i = 0; i < n; i += width) {
+            const size_t row_size = std::min(width, n - i);
+            std::copy(accumulators.data(), accumulators.data() + row_size, &temporaries[i]);
+            for (size_t j = 0; j < row_size; ++j) {
+                row[j] = coeffs[i + j].is_zero() ? one() : coeffs[i + j];
+            }
+            mul_batch(accumulators.data(), row.data(), accumulators.data(), row_size);
+        }
+
+        // zeroes were skipped, so no column product is zero
+        batch_invert(std::span{ accumulators });
+
+        for (size_t row_index = (n + width - 1) / width; row_index-- > 0;) {
+            const size_t i = row_index * width;
+            const size_t row_size = std::min(width, n - i);
+            for (size_t j = 0; j < row_size; ++j) {
+                row[j] = coeffs[i + j].is_zero() ? one() : coeffs[i + j];
+            }
+            mul_batch(accumulators.data(), &temporaries[i], &temporaries[i], row_size);
+            mul_batch(accumulators.data(), row.data(), accumulators.data(), row_size);
+            for (size_t j = 0; j < row_size; ++j) {
+                if (!coeffs[i + j].is_zero()) {
+                    coeffs[i + j] = temporaries[i + j];
+                }
+            }
+        }
+        return;
+    }
+
     std::vector<field> temporaries;
     std::vector<bool> skipped;
     temporaries.reserve(n);
@@ -390,6 +431,73 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T> void field<T>::mul_batch(const field* a, const field* b, field* out, const size_t n) noexcept
+{
+    size_t i = 0;
+#if (BBERG_NO_ASM == 0)
+    // same moduli as the ADX code: < 255 bits and > 64 bits
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL &&
+                  (T::modulus_1 != 0 || T::modulus_2 != 0 || T::modulus_3 != 0)) {
+        if (ifma::cpu_supports_ifma()) {
+            i = ifma::mul_batch<T>(reinterpret_cast<const uint64_t*>(a),
+                                   reinterpret_cast<const uint64_t*>(b),
+                                   reinterpret_cast<uint64_t*>(out),
+                                   n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <class T> void field<T>::mul_batch(const field* a, const field& b, field* out, const size_t n) noexcept
+{
+    size_t i = 0;
+#if (BBERG_NO_ASM == 0)
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL &&
+                  (T::modulus_1 != 0 || T::modulus_2 != 0 || T::modulus_3 != 0)) {
+        if (ifma::cpu_supports_ifma()) {
+            i = ifma::mul_batch_by_scalar<T>(
+                reinterpret_cast<const uint64_t*>(a), &b.data[0], reinterpret_cast<uint64_t*>(out), n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
+template <class T> void field<T>::sqr_batch(const field* a, field* out, const size_t n) noexcept
+{
+    size_t i = 0;
+#if (BBERG_NO_ASM == 0)
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL &&
+                  (T::modulus_1 != 0 || T::modulus_2 != 0 || T::modulus_3 != 0)) {
+        if (ifma::cpu_supports_ifma()) {
+            i = ifma::sqr_batch<T>(reinterpret_cast<const uint64_t*>(a), reinterpret_cast<uint64_t*>(out), n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i].sqr();
+    }
+}
+
+template <class T> void field<T>::add_batch(const field* a, const field* b, field* out, const size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <class T> void field<T>::sub_batch(const field* a, const field* b, field* out, const size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     // Tonelli-shanks algorithm begins by finding a field element Q and integer S,
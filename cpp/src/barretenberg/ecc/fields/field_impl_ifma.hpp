@@ -0,0 +1,264 @@
+#pragma once
+
+#if (BBERG_NO_ASM == 0)
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+/**
+ * AVX-512 IFMA kernels for the array methods of `field` (`mul_batch`, `sqr_batch`).
+ *
+ * The build targets a baseline x86-64 CPU, so the kernels are compiled with a function-level target attribute and are
+ * only called once `cpu_supports_ifma` has confirmed, at runtime, that the CPU can execute them.
+ *
+ * Each 512-bit register holds one limb of 8 field elements. Elements are converted from 4 64-bit limbs into 5 52-bit
+ * limbs, so that `vpmadd52luq` / `vpmadd52huq` can multiply limbs and accumulate the low / high 52 bits of the 104-bit
+ * products into 64-bit lanes without carry handling. The product is reduced with 4 52-bit Montgomery steps and a final
+ * 48-bit step, i.e. divided by 2^256. This matches the Montgomery form of the scalar code, so results are
+ * interchangeable with those of `operator*`.
+ *
+ * Like the ADX code, the kernels only apply to moduli of at most 254 bits, and they accept and produce elements in the
+ * range [0, 2p).
+ **/
+#define BBERG_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+// gcc 12's shift and shuffle intrinsics self-initialise their (ignored) pass-through operand, which trips these warnings
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace barretenberg {
+namespace ifma {
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+constexpr uint64_t FINAL_STEP_MASK = (1ULL << 48) - 1;
+constexpr size_t NUM_LANES = 8;
+
+// is the CPU (and the OS, which must save the 512-bit registers) able to run the kernels in this file?
+inline bool cpu_supports_ifma() noexcept
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+// split the 4 64-bit limbs in `x` into the 5 52-bit limbs in `r`
+BBERG_IFMA_TARGET inline void to_radix_52(const __m512i* x, __m512i* r) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    r[0] = _mm512_and_si512(x[0], mask);
+    r[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[0], 52), _mm512_slli_epi64(x[1], 12)), mask);
+    r[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[1], 40), _mm512_slli_epi64(x[2], 24)), mask);
+    r[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(x[2], 28), _mm512_slli_epi64(x[3], 36)), mask);
+    r[4] = _mm512_srli_epi64(x[3], 16);
+}
+
+// load elements `src[0..8)` (as 32 consecutive 64-bit limbs), transpose them into limb-major order and split the limbs
+BBERG_IFMA_TARGET inline void load(const uint64_t* src, __m512i* r) noexcept
+{
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+    __m512i x[4];
+    for (long long j = 0; j < 4; ++j) {
+        // limb j of elements 0-3 from (v0, v1) into lanes 0-3, and of elements 4-7 from (v2, v3) into lanes 4-7
+        const __m512i idx = _mm512_setr_epi64(j, j + 4, j + 8, j + 12, j, j + 4, j + 8, j + 12);
+        x[j] = _mm512_mask_blend_epi64(
+            0xf0, _mm512_permutex2var_epi64(v0, idx, v1), _mm512_permutex2var_epi64(v2, idx, v3));
+    }
+    to_radix_52(x, r);
+}
+
+BBERG_IFMA_TARGET inline void broadcast(const uint64_t* src, __m512i* r) noexcept
+{
+    const __m512i x[4]{ _mm512_set1_epi64(static_cast<long long>(src[0])),
+                        _mm512_set1_epi64(static_cast<long long>(src[1])),
+                        _mm512_set1_epi64(static_cast<long long>(src[2])),
+                        _mm512_set1_epi64(static_cast<long long>(src[3])) };
+    to_radix_52(x, r);
+}
+
+// inverse of `load`: merge the 52-bit limbs of `r` back into 64-bit limbs and store the 8 elements at `dest`
+BBERG_IFMA_TARGET inline void store(const __m512i* r, uint64_t* dest) noexcept
+{
+    const __m512i y0 = _mm512_or_si512(r[0], _mm512_slli_epi64(r[1], 52));
+    const __m512i y1 = _mm512_or_si512(_mm512_srli_epi64(r[1], 12), _mm512_slli_epi64(r[2], 40));
+    const __m512i y2 = _mm512_or_si512(_mm512_srli_epi64(r[2], 24), _mm512_slli_epi64(r[3], 28));
+    const __m512i y3 = _mm512_or_si512(_mm512_srli_epi64(r[3], 36), _mm512_slli_epi64(r[4], 16));
+
+    // in 128-bit blocks: p = [y0, y1] of elements 0, 2, 4, 6. q = [y2, y3] of elements 0, 2, 4, 6.
+    // s, t = the same for elements 1, 3, 5, 7
+    const __m512i p = _mm512_unpacklo_epi64(y0, y1);
+    const __m512i q = _mm512_unpacklo_epi64(y2, y3);
+    const __m512i s = _mm512_unpackhi_epi64(y0, y1);
+    const __m512i t = _mm512_unpackhi_epi64(y2, y3);
+    const __m512i lo_idx = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+    const __m512i hi_idx = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+    const __m512i pq_lo = _mm512_permutex2var_epi64(p, lo_idx, q);
+    const __m512i st_lo = _mm512_permutex2var_epi64(s, lo_idx, t);
+    const __m512i pq_hi = _mm512_permutex2var_epi64(p, hi_idx, q);
+    const __m512i st_hi = _mm512_permutex2var_epi64(s, hi_idx, t);
+    _mm512_storeu_si512(dest, _mm512_shuffle_i64x2(pq_lo, st_lo, 0x44));
+    _mm512_storeu_si512(dest + 8, _mm512_shuffle_i64x2(pq_lo, st_lo, 0xee));
+    _mm512_storeu_si512(dest + 16, _mm512_shuffle_i64x2(pq_hi, st_hi, 0x44));
+    _mm512_storeu_si512(dest + 24, _mm512_shuffle_i64x2(pq_hi, st_hi, 0xee));
+}
+
+template <class Params> struct constants {
+    static constexpr uint64_t modulus[5]{
+        Params::modulus_0 & LIMB_MASK,
+        ((Params::modulus_0 >> 52) | (Params::modulus_1 << 12)) & LIMB_MASK,
+        ((Params::modulus_1 >> 40) | (Params::modulus_2 << 24)) & LIMB_MASK,
+        ((Params::modulus_2 >> 28) | (Params::modulus_3 << 36)) & LIMB_MASK,
+        Params::modulus_3 >> 16,
+    };
+    // -p^{-1} mod 2^52
+    static constexpr uint64_t r_inv = Params::r_inv & LIMB_MASK;
+};
+
+/**
+ * Montgomery-reduce the 10-limb product `t` into `r`.
+ * The lanes of `t` may exceed 52 bits; they only need to leave room for the limbs added by the reduction.
+ **/
+template <class Params> BBERG_IFMA_TARGET inline void montgomery_reduce(__m512i* t, __m512i* r) noexcept
+{
+    using c = constants<Params>;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(LIMB_MASK));
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<long long>(c::r_inv));
+    __m512i p[5];
+    for (size_t j = 0; j < 5; ++j) {
+        p[j] = _mm512_set1_epi64(static_cast<long long>(c::modulus[j]));
+    }
+
+    // add the multiple of p that zeroes the lowest limb, and shift its carry into the next limb
+    for (size_t k = 0; k < 4; ++k) {
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[k], r_inv);
+        for (size_t j = 0; j < 5; ++j) {
+            t[k + j] = _mm512_madd52lo_epu64(t[k + j], m, p[j]);
+            t[k + j + 1] = _mm512_madd52hi_epu64(t[k + j + 1], m, p[j]);
+        }
+        t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+    }
+
+    // we have divided by 2^208. Zero the low 48 bits of the remainder, to divide by 2^256 in total
+    const __m512i final_step_mask = _mm512_set1_epi64(static_cast<long long>(FINAL_STEP_MASK));
+    const __m512i m = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t[4], r_inv), final_step_mask);
+    for (size_t j = 0; j < 5; ++j) {
+        t[4 + j] = _mm512_madd52lo_epu64(t[4 + j], m, p[j]);
+        t[5 + j] = _mm512_madd52hi_epu64(t[5 + j], m, p[j]);
+    }
+    for (size_t k = 4; k < 9; ++k) {
+        t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+        t[k] = _mm512_and_si512(t[k], mask);
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        const __m512i hi = _mm512_and_si512(_mm512_slli_epi64(t[5 + i], 4), mask);
+        r[i] = _mm512_or_si512(_mm512_srli_epi64(t[4 + i], 48), hi);
+    }
+}
+
+template <class Params>
+BBERG_IFMA_TARGET inline void montgomery_mul(const __m512i* a, const __m512i* b, __m512i* r) noexcept
+{
+    __m512i t[10];
+    for (size_t k = 0; k < 10; ++k) {
+        t[k] = _mm512_setzero_si512();
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+        }
+    }
+    montgomery_reduce<Params>(t, r);
+}
+
+template <class Params> BBERG_IFMA_TARGET inline void montgomery_square(const __m512i* a, __m512i* r) noexcept
+{
+    __m512i t[10];
+    for (size_t k = 0; k < 10; ++k) {
+        t[k] = _mm512_setzero_si512();
+    }
+    // cross products a[i] * a[j], i < j, are computed once and doubled
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = i + 1; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], a[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], a[j]);
+        }
+    }
+    for (size_t k = 0; k < 10; ++k) {
+        t[k] = _mm512_add_epi64(t[k], t[k]);
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        t[2 * i] = _mm512_madd52lo_epu64(t[2 * i], a[i], a[i]);
+        t[2 * i + 1] = _mm512_madd52hi_epu64(t[2 * i + 1], a[i], a[i]);
+    }
+    montgomery_reduce<Params>(t, r);
+}
+
+/**
+ * out[i] = a[i] * b[i] for the largest multiple of 8 elements that does not exceed n.
+ * Operands are arrays of 4-limb elements. `out` may alias `a` or `b`. Returns the number of elements processed
+ **/
+template <class Params>
+BBERG_IFMA_TARGET size_t mul_batch(const uint64_t* a, const uint64_t* b, uint64_t* out, const size_t n) noexcept
+{
+    size_t i = 0;
+    for (; i + NUM_LANES <= n; i += NUM_LANES) {
+        __m512i x[5];
+        __m512i y[5];
+        __m512i r[5];
+        load(a + 4 * i, x);
+        load(b + 4 * i, y);
+        montgomery_mul<Params>(x, y, r);
+        store(r, out + 4 * i);
+    }
+    return i;
+}
+
+// out[i] = a[i] * b, for the largest multiple of 8 elements that does not exceed n
+template <class Params>
+BBERG_IFMA_TARGET size_t mul_batch_by_scalar(const uint64_t* a,
+                                             const uint64_t* b,
+                                             uint64_t* out,
+                                             const size_t n) noexcept
+{
+    __m512i y[5];
+    broadcast(b, y);
+    size_t i = 0;
+    for (; i + NUM_LANES <= n; i += NUM_LANES) {
+        __m512i x[5];
+        __m512i r[5];
+        load(a + 4 * i, x);
+        montgomery_mul<Params>(x, y, r);
+        store(r, out + 4 * i);
+    }
+    return i;
+}
+
+// out[i] = a[i]^2, for the largest multiple of 8 elements that does not exceed n
+template <class Params> BBERG_IFMA_TARGET size_t sqr_batch(const uint64_t* a, uint64_t* out, const size_t n) noexcept
+{
+    size_t i = 0;
+    for (; i + NUM_LANES <= n; i += NUM_LANES) {
+        __m512i x[5];
+        __m512i r[5];
+        load(a + 4 * i, x);
+        montgomery_square<Params>(x, r);
+        store(r, out + 4 * i);
+    }
+    return i;
+}
+
+} // namespace ifma
+} // namespace barretenberg
+
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#undef BBERG_IFMA_TARGET
+#endif
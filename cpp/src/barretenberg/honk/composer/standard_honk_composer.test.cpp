@@ -454,4 +454,40 @@ TEST(StandardHonkComposer, TwoGates)
     run_test(/* expect_verified=*/true);
     run_test(/* expect_verified=*/false);
 }
+
+TEST(StandardHonkComposer, VerifyProofs)
+{
+    // a * b - c = 0, for a witness that may or may not satisfy it
+    const auto prove = [](const fr& a, const fr& b, const fr& c) {
+        auto composer = StandardHonkComposer();
+        uint32_t a_idx = composer.circuit_constructor.add_variable(a);
+        uint32_t b_idx = composer.circuit_constructor.add_variable(b);
+        uint32_t c_idx = composer.circuit_constructor.add_variable(c);
+        composer.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+        auto prover = composer.create_prover();
+        return prover.construct_proof();
+    };
+
+    constexpr size_t num_proofs = 4;
+    std::vector<plonk::proof> proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        proofs.push_back(prove(a, b, a * b));
+    }
+
+    // every instance of the circuit has the same verification key
+    auto composer = StandardHonkComposer();
+    uint32_t a_idx = composer.circuit_constructor.add_variable(2);
+    uint32_t b_idx = composer.circuit_constructor.add_variable(3);
+    uint32_t c_idx = composer.circuit_constructor.add_variable(6);
+    composer.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+    auto verifier = composer.create_verifier();
+    EXPECT_TRUE(verifier.verify_proofs(proofs));
+
+    proofs[2] = prove(2, 3, 7);
+    std::vector<size_t> failing_proofs;
+    EXPECT_FALSE(verifier.verify_proofs(proofs, &failing_proofs));
+    EXPECT_EQ(failing_proofs, std::vector<size_t>({ 2 }));
+}
 } // namespace test_standard_honk_composer
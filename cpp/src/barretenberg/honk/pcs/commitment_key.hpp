@@ -9,11 +9,13 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/reference_string/file_reference_string.hpp"
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_state_pool.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 
 #include <string_view>
 #include <memory>
+#include <vector>
 
 namespace honk::pcs {
 
@@ -64,6 +66,52 @@ class CommitmentKey {
             const_cast<Fr*>(polynomial.data()), srs.get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Commits to several polynomials in batched MSM passes over the SRS, one per distinct size
+     *
+     * @details Polynomials of the same size are evaluated in a single batched MSM. Those of different sizes cannot
+     * share one without padding the smaller ones with zeros to the size of the largest, so each size gets its own
+     * batch (for instance, the Gemini folds all have different sizes).
+     *
+     * @param polynomials univariate polynomials pⱼ(X)
+     * @return the commitments [pⱼ(x)], in the same order as the polynomials
+     */
+    std::vector<C> batch_commit(const std::vector<std::span<const Fr>>& polynomials)
+    {
+        std::vector<C> commitments(polynomials.size());
+        if (polynomials.empty()) {
+            return commitments;
+        }
+        size_t max_degree = 0;
+        for (const auto& polynomial : polynomials) {
+            max_degree = std::max(max_degree, polynomial.size());
+        }
+        ASSERT(max_degree <= srs.get_monomial_size());
+
+        std::vector<bool> committed(polynomials.size(), false);
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            if (committed[i]) {
+                continue;
+            }
+            const size_t degree = polynomials[i].size();
+            std::vector<Fr*> scalars;
+            std::vector<size_t> indices;
+            for (size_t j = i; j < polynomials.size(); ++j) {
+                if (!committed[j] && polynomials[j].size() == degree) {
+                    scalars.push_back(const_cast<Fr*>(polynomials[j].data()));
+                    indices.push_back(j);
+                    committed[j] = true;
+                }
+            }
+            const auto results = barretenberg::scalar_multiplication::get_runtime_state_pool().pippenger_batch_unsafe(
+                scalars, srs.get_monomial_points(), degree);
+            for (size_t k = 0; k < indices.size(); ++k) {
+                commitments[indices[k]] = results[k];
+            }
+        }
+        return commitments;
+    };
+
   private:
     barretenberg::scalar_multiplication::pippenger_runtime_state pippenger_runtime_state;
     bonk::FileReferenceString srs;
@@ -107,6 +155,11 @@ class VerificationKey {
         return (result == barretenberg::fq12::one());
     }
 
+    barretenberg::pairing::miller_lines const* get_precomputed_g2_lines() const
+    {
+        return verifier_srs.get_precomputed_g2_lines();
+    }
+
   private:
     bonk::VerifierFileReferenceString verifier_srs;
 };
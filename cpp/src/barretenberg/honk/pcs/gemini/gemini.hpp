@@ -6,6 +6,8 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include <memory>
 #include <vector>
 
@@ -116,29 +118,21 @@ template <typename Params> class MultilinearReductionScheme {
                                              const auto& transcript)
     {
         const size_t num_variables = mle_opening_point.size(); // m
+        const size_t n = batched_shifted.size();
 
-        // Allocate space for m+1 Fold polynomials
-        //
-        // At the end, the first two will contain the batched polynomial
-        // partially evaluated at the challenges r,-r.
-        // The other m-1 polynomials correspond to the foldings of A₀
-        std::vector<Polynomial> fold_polynomials;
-        fold_polynomials.reserve(num_variables + 1);
         // F(X) = ∑ⱼ ρʲ   fⱼ(X)
-        Polynomial& batched_F = fold_polynomials.emplace_back(batched_shifted);
-        // G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
-        Polynomial& batched_G = fold_polynomials.emplace_back(batched_to_be_shifted);
+        const Fr* batched_F = batched_shifted.get_coefficients();
+        // G↺(X) = G(X)/X, where G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
+        const Fr* batched_G = batched_to_be_shifted.get_coefficients();
+        const auto batched_G_shifted = batched_to_be_shifted.shifted();
 
-        // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X.
-        Polynomial A_0(batched_F);
-        A_0 += batched_G.shifted();
+        // The m+1 Fold polynomials share a single block of memory: A₀₊ and A₀₋ of size n, then Aₗ of size 2ᵐ⁻ˡ
+        std::vector<Polynomial> fold_polynomials = allocate_fold_polynomials(num_variables, n);
 
-        // Create the folded polynomials A₁(X),…,Aₘ₋₁(X)
+        // Create the folded polynomials A₁(X),…,Aₘ₋₁(X), each level split across threads
         //
-        // A_l = Aₗ(X) is the polynomial being folded
-        // in the first iteration, we take the batched polynomial
-        // in the next iteration, it is the previously folded one
-        Fr* A_l = A_0.get_coefficients();
+        // A₁ is folded from A₀(X) = F(X) + G↺(X), which is never materialised: its coefficients are computed as they
+        // are read. The next ones are folded from the previous one.
         for (size_t l = 0; l < num_variables - 1; ++l) {
             const Fr u_l = mle_opening_point[l];
 
@@ -146,29 +140,38 @@ template <typename Params> class MultilinearReductionScheme {
             const size_t n_l = 1 << (num_variables - l - 1);
 
             // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-            Fr* A_l_fold = fold_polynomials.emplace_back(Polynomial(n_l)).get_coefficients();
-
-            // fold the previous polynomial with odd and even parts
-            for (size_t i = 0; i < n_l; ++i) {
-                // TODO(#219)(Adrian) parallelize
-
-                // fold(Aₗ)[i] = (1-uₗ)⋅even(Aₗ)[i] + uₗ⋅odd(Aₗ)[i]
-                //            = (1-uₗ)⋅Aₗ[2i]      + uₗ⋅Aₗ[2i+1]
-                //            = Aₗ₊₁[i]
-                A_l_fold[i] = A_l[i << 1] + u_l * (A_l[(i << 1) + 1] - A_l[i << 1]);
-            }
-
-            // set Aₗ₊₁ = Aₗ for the next iteration
-            A_l = A_l_fold;
+            Fr* A_l_fold = fold_polynomials[l + 2].get_coefficients();
+            const Fr* A_l = (l == 0) ? nullptr : fold_polynomials[l + 1].get_coefficients();
+
+            barretenberg::parallel_for(
+                n_l,
+                [&](const size_t start, const size_t end) {
+                    for (size_t i = start; i < end; ++i) {
+                        // fold(Aₗ)[i] = (1-uₗ)⋅even(Aₗ)[i] + uₗ⋅odd(Aₗ)[i]
+                        //            = (1-uₗ)⋅Aₗ[2i]      + uₗ⋅Aₗ[2i+1]
+                        //            = Aₗ₊₁[i]
+                        const Fr even = (l == 0) ? batched_F[i << 1] + batched_G_shifted[i << 1] : A_l[i << 1];
+                        const Fr odd =
+                            (l == 0) ? batched_F[(i << 1) + 1] + batched_G_shifted[(i << 1) + 1] : A_l[(i << 1) + 1];
+                        A_l_fold[i] = even + u_l * (odd - even);
+                    }
+                },
+                MIN_FOLD_GRAIN_SIZE);
         }
 
         /*
-         * Create commitments C₁,…,Cₘ₋₁ to polynomials FOLD_i, i = 1,...,d-1 and add to transcript
+         * Create commitments C₁,…,Cₘ₋₁ to polynomials FOLD_i, i = 1,...,d-1 in a single batch and add to transcript
          */
+        std::vector<std::span<const Fr>> folds;
+        folds.reserve(num_variables - 1);
+        for (size_t l = 0; l < num_variables - 1; ++l) {
+            folds.emplace_back(fold_polynomials[l + 2]);
+        }
+        const auto fold_commitments = ck->batch_commit(folds);
         std::vector<Commitment> commitments;
         commitments.reserve(num_variables - 1);
         for (size_t l = 0; l < num_variables - 1; ++l) {
-            commitments.emplace_back(ck->commit(fold_polynomials[l + 2]));
+            commitments.emplace_back(fold_commitments[l]);
             transcript->add_element("FOLD_" + std::to_string(l + 1),
                                     static_cast<CommitmentAffine>(commitments[l]).to_buffer());
         }
@@ -190,28 +193,21 @@ template <typename Params> class MultilinearReductionScheme {
 
         // 2 simulated polynomials and (m-1) polynomials from this round
         Fr r_inv = r_challenge.invert();
-        // G(X) *= r⁻¹
-        batched_G *= r_inv;
-
-        // To avoid an extra allocation, we reuse the following polynomials
-        // but rename them to represent the result.
-        // tmp     = A₀(X) (&tmp     == &A_0)
-        // A_0_pos = F(X)  (&A_0_pos == &batched_F)
-        Polynomial& tmp = A_0;
-        Polynomial& A_0_pos = fold_polynomials[0];
 
-        tmp = batched_F;
         // A₀₊(X) = F(X) + G(X)/r, s.t. A₀₊(r) = A₀(r)
-        A_0_pos += batched_G;
-
-        std::swap(tmp, batched_G);
-        // After the swap, we have
-        // tmp = G(X)/r
-        // A_0_neg = F(X) (since &batched_F == &A_0_neg)
-        Polynomial& A_0_neg = fold_polynomials[1];
-
         // A₀₋(X) = F(X) - G(X)/r, s.t. A₀₋(-r) = A₀(-r)
-        A_0_neg -= tmp;
+        Fr* A_0_pos = fold_polynomials[0].get_coefficients();
+        Fr* A_0_neg = fold_polynomials[1].get_coefficients();
+        barretenberg::parallel_for(
+            n,
+            [&](const size_t start, const size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    const Fr G_over_r = batched_G[i] * r_inv;
+                    A_0_pos[i] = batched_F[i] + G_over_r;
+                    A_0_neg[i] = batched_F[i] - G_over_r;
+                }
+            },
+            MIN_FOLD_GRAIN_SIZE);
 
         /*
          * Compute the m+1 evaluations Aₗ(−r^{2ˡ}), l = 0, ..., m-1.
@@ -326,6 +322,43 @@ template <typename Params> class MultilinearReductionScheme {
     };
 
   private:
+    // Smallest range of coefficients handed to one thread when folding
+    static constexpr size_t MIN_FOLD_GRAIN_SIZE = 1UL << 10;
+
+    /**
+     * @brief Allocate the m+1 Fold polynomials, A₀₊ and A₀₋ of size n and Aₗ of size 2ᵐ⁻ˡ for l = 1, ..., m-1, as
+     * views into a single block from the polynomial arena, which is released when the last of them is.
+     *
+     * @details Each polynomial is followed by a zero coefficient, as a Polynomial of its size would be. The views are
+     * read only to the Polynomial interface: their coefficients are written through get_coefficients() in
+     * reduce_prove, and only read after it.
+     */
+    static std::vector<Polynomial> allocate_fold_polynomials(const size_t num_variables, const size_t n)
+    {
+        std::vector<size_t> sizes = { n, n };
+        for (size_t l = 1; l < num_variables; ++l) {
+            sizes.emplace_back(1UL << (num_variables - l));
+        }
+        size_t total_size = 0;
+        for (const size_t size : sizes) {
+            total_size += size + 1;
+        }
+
+        auto& arena = barretenberg::get_polynomial_arena();
+        std::shared_ptr<void> block(arena.allocate(total_size * sizeof(Fr)),
+                                    [&arena](void* ptr) { arena.deallocate(ptr); });
+        Fr* coefficients = static_cast<Fr*>(block.get());
+
+        std::vector<Polynomial> fold_polynomials;
+        fold_polynomials.reserve(sizes.size());
+        for (const size_t size : sizes) {
+            coefficients[size] = Fr::zero();
+            fold_polynomials.emplace_back(block, coefficients, size);
+            coefficients += size + 1;
+        }
+        return fold_polynomials;
+    };
+
     /**
      * @brief computes the output pair given the transcript.
      * This method is common for both prover and verifier.
@@ -79,4 +79,45 @@ TYPED_TEST(ShplonkTest, GeminiShplonk)
 
     this->verify_opening_claim(verifier_claim, shplonk_prover_witness);
 }
+
+// The batched quotient, split into ranges across threads, matches dividing each polynomial on its own
+TYPED_TEST(ShplonkTest, BatchedQuotientMultithreaded)
+{
+    using Shplonk = SingleBatchOpeningScheme<TypeParam>;
+    using Fr = typename TypeParam::Fr;
+    using Polynomial = typename barretenberg::Polynomial<Fr>;
+
+    const size_t n = 1UL << 12;
+    const std::vector<size_t> sizes = { n, n, n / 2, n / 4 + 3, 2 };
+
+    std::vector<Polynomial> witnesses;
+    std::vector<OpeningPair<TypeParam>> opening_pairs;
+    std::vector<Fr> nu_powers;
+    for (const size_t size : sizes) {
+        auto& witness = witnesses.emplace_back(this->random_polynomial(size));
+        const Fr query = this->random_element();
+        opening_pairs.emplace_back(OpeningPair<TypeParam>{ query, witness.evaluate(query) });
+        nu_powers.emplace_back(this->random_element());
+    }
+    // a root at zero
+    witnesses.emplace_back(this->random_polynomial(n));
+    opening_pairs.emplace_back(OpeningPair<TypeParam>{ Fr::zero(), witnesses.back()[0] });
+    nu_powers.emplace_back(this->random_element());
+
+    Polynomial expected_Q(n);
+    for (size_t j = 0; j < witnesses.size(); ++j) {
+        Polynomial tmp = witnesses[j];
+        tmp[0] -= opening_pairs[j].evaluation;
+        tmp.factor_roots(opening_pairs[j].query);
+        expected_Q.add_scaled(tmp, nu_powers[j]);
+    }
+
+    const size_t num_threads = barretenberg::get_num_threads();
+    barretenberg::set_num_threads(4);
+    Polynomial Q(n);
+    Shplonk::compute_batched_quotient(Q, opening_pairs, witnesses, nu_powers);
+    barretenberg::set_num_threads(num_threads);
+
+    EXPECT_EQ(Q, expected_Q);
+}
 } // namespace honk::pcs::shplonk
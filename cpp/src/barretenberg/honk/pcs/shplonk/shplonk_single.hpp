@@ -2,6 +2,7 @@
 #include "barretenberg/honk/pcs/claim.hpp"
 #include "shplonk.hpp"
 #include "barretenberg/honk/pcs/commitment_key.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 namespace honk::pcs::shplonk {
 
@@ -45,24 +46,19 @@ template <typename Params> class SingleBatchOpeningScheme {
         for (const auto& poly : witness_polynomials) {
             max_poly_size = std::max(max_poly_size, poly.size());
         }
-        // Q(X) = ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-        Polynomial Q(max_poly_size);
-        Polynomial tmp(max_poly_size);
-
-        Fr current_nu = Fr::one();
-        for (size_t j = 0; j < num_opening_pairs; ++j) {
-            // (Cⱼ, xⱼ, vⱼ)
-            const auto& [query, evaluation] = opening_pairs[j];
-
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            tmp = witness_polynomials[j];
-            tmp[0] -= evaluation;
-            tmp.factor_roots(query);
 
-            Q.add_scaled(tmp, current_nu);
-            current_nu *= nu;
+        // {νʲ}ⱼ
+        std::vector<Fr> nu_powers;
+        nu_powers.reserve(num_opening_pairs);
+        nu_powers.emplace_back(Fr::one());
+        for (size_t j = 1; j < num_opening_pairs; ++j) {
+            nu_powers.emplace_back(nu_powers[j - 1] * nu);
         }
 
+        // Q(X) = ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
+        Polynomial Q(max_poly_size);
+        compute_batched_quotient(Q, opening_pairs, witness_polynomials, nu_powers);
+
         // [Q]
         Commitment Q_commitment = ck->commit(Q);
         transcript->add_element("Q", static_cast<CommitmentAffine>(Q_commitment).to_buffer());
@@ -81,27 +77,38 @@ template <typename Params> class SingleBatchOpeningScheme {
             Fr::batch_invert(inverse_vanishing_evals);
         }
 
-        // G(X) = Q(X) - Q_z(X) = Q(X) - ∑ⱼ ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ),
+        // G(X) = Q(X) - Q_z(X) = Q(X) - ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ),
         // s.t. G(r) = 0
         Polynomial& G = Q;
 
-        // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
-        current_nu = Fr::one();
+        // νʲ / ( r − xⱼ )
+        std::vector<Fr> scaling_factors;
+        scaling_factors.reserve(num_opening_pairs);
+        // G₀ = ∑ⱼ νʲ ⋅ vⱼ / ( r − xⱼ )
+        Fr G_constant = Fr::zero();
         for (size_t j = 0; j < num_opening_pairs; ++j) {
-            // (Cⱼ, xⱼ, vⱼ)
-            const auto& [query, evaluation] = opening_pairs[j];
-
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = witness_polynomials[j];
-            tmp[0] -= evaluation;
-            Fr scaling_factor = current_nu * inverse_vanishing_evals[j]; // = ρʲ / ( r − xⱼ )
-
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
-
-            current_nu *= nu;
+            scaling_factors.emplace_back(nu_powers[j] * inverse_vanishing_evals[j]);
+            G_constant += scaling_factors[j] * opening_pairs[j].evaluation;
         }
 
+        // G -= ∑ⱼ νʲ ⋅ fⱼ(X) / ( r − xⱼ ), in one pass over the coefficients of G
+        barretenberg::parallel_for(
+            max_poly_size,
+            [&](const size_t start, const size_t end) {
+                for (size_t k = start; k < end; ++k) {
+                    Fr sum = Fr::zero();
+                    for (size_t j = 0; j < num_opening_pairs; ++j) {
+                        if (k < witness_polynomials[j].size()) {
+                            sum += scaling_factors[j] * witness_polynomials[j][k];
+                        }
+                    }
+                    G[k] -= sum;
+                }
+            },
+            MIN_GRAIN_SIZE);
+        // G += ∑ⱼ νʲ ⋅ vⱼ / ( r − xⱼ )
+        G[0] += G_constant;
+
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
         return { .opening_pair = { .query = z_challenge, .evaluation = Fr::zero() }, .witness = std::move(G) };
     };
@@ -165,5 +172,99 @@ template <typename Params> class SingleBatchOpeningScheme {
         // Return opening pair (z, 0) and commitment [G]
         return { { z_challenge, Fr::zero() }, G_commitment };
     };
+
+    // Smallest range of coefficients handed to one thread
+    static constexpr size_t MIN_GRAIN_SIZE = 1UL << 10;
+
+    /**
+     * @brief Compute Q(X) = ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ) in one pass over the coefficients of the fⱼ, split
+     * across threads.
+     *
+     * @details The quotient q(X) = ∑ᵢ bᵢ⋅Xⁱ of f(X) = ∑ᵢ aᵢ⋅Xⁱ by (X − x) is given from the top by bₙ₋₂ = aₙ₋₁ and
+     * bᵢ₋₁ = aᵢ + x⋅bᵢ, so that bᵢ₋₁ = ∑ₖ₌ᵢ aₖ⋅xᵏ⁻ⁱ. It does not depend on a₀, so nor on vⱼ. The coefficients are
+     * split into one range [s, e) per thread. A first pass computes ∑ₖ₌ₛ^{e-1} aₖ⋅xᵏ⁻ˢ for every range and fⱼ, from
+     * which bₑ₋₁, where the recurrence enters each range, follows range by range from the top. The second pass runs
+     * the recurrences of all the fⱼ through each range at once and writes each coefficient of Q once.
+     *
+     * @param Q set to ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ), of the size of the largest fⱼ
+     * @param opening_pairs the (xⱼ, vⱼ)
+     * @param witness_polynomials the fⱼ
+     * @param nu_powers the νʲ
+     */
+    static void compute_batched_quotient(Polynomial& Q,
+                                         std::span<const OpeningPair<Params>> opening_pairs,
+                                         std::span<const Polynomial> witness_polynomials,
+                                         std::span<const Fr> nu_powers)
+    {
+        const size_t num_polynomials = opening_pairs.size();
+        const size_t size = Q.size();
+        if (size == 0) {
+            return;
+        }
+        const size_t range_size =
+            std::max((size + barretenberg::get_num_threads() - 1) / barretenberg::get_num_threads(), MIN_GRAIN_SIZE);
+        const size_t num_ranges = (size + range_size - 1) / range_size;
+
+        // aₖ of fⱼ, which is zero past its size
+        const auto coefficient = [&](const size_t j, const size_t k) {
+            return (k < witness_polynomials[j].size()) ? witness_polynomials[j][k] : Fr::zero();
+        };
+
+        // ∑ₖ₌ₛ^{e-1} aₖ⋅xⱼᵏ⁻ˢ of every range and fⱼ
+        std::vector<Fr> range_sums(num_ranges * num_polynomials);
+        barretenberg::parallel_for(num_ranges, [&](const size_t range_start, const size_t range_end) {
+            for (size_t range = range_start; range < range_end; ++range) {
+                const size_t start = range * range_size;
+                const size_t end = std::min(start + range_size, size);
+                for (size_t j = 0; j < num_polynomials; ++j) {
+                    const Fr& x = opening_pairs[j].query;
+                    Fr sum = Fr::zero();
+                    for (size_t k = end; k > start; --k) {
+                        sum = sum * x + coefficient(j, k - 1);
+                    }
+                    range_sums[range * num_polynomials + j] = sum;
+                }
+            }
+        });
+
+        // bₑ₋₁ of every range and fⱼ, from the top range down
+        std::vector<Fr> carries(num_ranges * num_polynomials);
+        for (size_t j = 0; j < num_polynomials; ++j) {
+            const Fr& x = opening_pairs[j].query;
+            const Fr x_pow_range_size = x.pow(static_cast<uint64_t>(range_size));
+            Fr carry = Fr::zero();
+            for (size_t range = num_ranges; range > 0; --range) {
+                carries[(range - 1) * num_polynomials + j] = carry;
+                const size_t start = (range - 1) * range_size;
+                const size_t end = std::min(start + range_size, size);
+                const Fr x_pow =
+                    (end - start == range_size) ? x_pow_range_size : x.pow(static_cast<uint64_t>(end - start));
+                carry = range_sums[(range - 1) * num_polynomials + j] + x_pow * carry;
+            }
+        }
+
+        barretenberg::parallel_for(num_ranges, [&](const size_t range_start, const size_t range_end) {
+            std::vector<Fr> quotients(num_polynomials);
+            for (size_t range = range_start; range < range_end; ++range) {
+                const size_t start = range * range_size;
+                const size_t end = std::min(start + range_size, size);
+                Fr sum = Fr::zero();
+                for (size_t j = 0; j < num_polynomials; ++j) {
+                    quotients[j] = carries[range * num_polynomials + j];
+                    sum += nu_powers[j] * quotients[j];
+                }
+                Q[end - 1] = sum;
+                for (size_t k = end - 1; k > start; --k) {
+                    sum = Fr::zero();
+                    for (size_t j = 0; j < num_polynomials; ++j) {
+                        // bₖ₋₁ = aₖ + xⱼ⋅bₖ
+                        quotients[j] = coefficient(j, k) + opening_pairs[j].query * quotients[j];
+                        sum += nu_powers[j] * quotients[j];
+                    }
+                    Q[k - 1] = sum;
+                }
+            }
+        });
+    };
 };
 } // namespace honk::pcs::shplonk
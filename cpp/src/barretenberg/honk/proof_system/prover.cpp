@@ -75,10 +75,14 @@ Prover<settings>::Prover(std::vector<barretenberg::polynomial>&& wire_polys,
  * */
 template <typename settings> void Prover<settings>::compute_wire_commitments()
 {
+    std::vector<std::span<const Fr>> wires;
     for (size_t i = 0; i < settings::program_width; ++i) {
-        auto commitment = commitment_key->commit(wire_polynomials[i]);
+        wires.emplace_back(wire_polynomials[i]);
+    }
+    const auto commitments = commitment_key->batch_commit(wires);
 
-        transcript.add_element("W_" + std::to_string(i + 1), commitment.to_buffer());
+    for (size_t i = 0; i < settings::program_width; ++i) {
+        transcript.add_element("W_" + std::to_string(i + 1), commitments[i].to_buffer());
     }
 }
 
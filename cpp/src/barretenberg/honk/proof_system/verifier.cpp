@@ -78,6 +78,43 @@ template <typename program_settings> Verifier<program_settings>& Verifier<progra
         [W]_1
 */
 template <typename program_settings> bool Verifier<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    auto kzg_claim = reduce_proof(proof);
+    return kzg_claim.has_value() && kzg_claim->verify(kate_verification_key);
+}
+
+template <typename program_settings>
+bool Verifier<program_settings>::verify_proofs(const std::vector<plonk::proof>& proofs,
+                                               std::vector<size_t>* failing_proofs)
+{
+    bonk::PairingAccumulator accumulator(kate_verification_key->get_precomputed_g2_lines());
+    for (const auto& proof : proofs) {
+        accumulate_proof(proof, accumulator);
+    }
+    if (accumulator.verify()) {
+        return true;
+    }
+    if (failing_proofs != nullptr) {
+        *failing_proofs = accumulator.get_failing_claims();
+    }
+    return false;
+}
+
+template <typename program_settings>
+void Verifier<program_settings>::accumulate_proof(const plonk::proof& proof, bonk::PairingAccumulator& accumulator)
+{
+    auto kzg_claim = reduce_proof(proof);
+    if (!kzg_claim.has_value()) {
+        accumulator.add_rejected_claim();
+        return;
+    }
+    accumulator.add_claim(static_cast<barretenberg::g1::affine_element>(kzg_claim->lhs),
+                          static_cast<barretenberg::g1::affine_element>(kzg_claim->rhs));
+}
+
+template <typename program_settings>
+std::optional<pcs::kzg::BilinearAccumulator<pcs::kzg::Params>> Verifier<program_settings>::reduce_proof(
+    const plonk::proof& proof)
 {
     using FF = typename program_settings::fr;
     using Commitment = barretenberg::g1::element;
@@ -133,7 +170,9 @@ template <typename program_settings> bool Verifier<program_settings>::verify_pro
                              ArithmeticRelation,
                              GrandProductComputationRelation,
                              GrandProductInitializationRelation>(transcript);
-    bool sumcheck_result = sumcheck.execute_verifier();
+    if (!sumcheck.execute_verifier()) {
+        return std::nullopt;
+    }
 
     // Execute Gemini/Shplonk verification:
 
@@ -200,14 +239,7 @@ template <typename program_settings> bool Verifier<program_settings>::verify_pro
     auto kzg_proof = transcript.get_group_element("W");
 
     // Aggregate inputs [Q] - [Q_z] and [W] into an 'accumulator' (can perform pairing check on result)
-    auto kzg_claim = KZG::reduce_verify(shplonk_claim, kzg_proof);
-
-    // Do final pairing check
-    bool pairing_result = kzg_claim.verify(kate_verification_key);
-
-    bool result = sumcheck_result && pairing_result;
-
-    return result;
+    return KZG::reduce_verify(shplonk_claim, kzg_proof);
 }
 
 template class Verifier<honk::standard_verifier_settings>;
@@ -11,6 +11,9 @@
 #include "barretenberg/honk/pcs/gemini/gemini.hpp"
 #include "barretenberg/honk/pcs/shplonk/shplonk_single.hpp"
 #include "barretenberg/honk/pcs/kzg/kzg.hpp"
+#include "barretenberg/proof_system/pairing_accumulator/pairing_accumulator.hpp"
+
+#include <optional>
 
 namespace honk {
 template <typename program_settings> class Verifier {
@@ -24,6 +27,18 @@ template <typename program_settings> class Verifier {
     Verifier& operator=(Verifier&& other);
 
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * Verify a batch of proofs against the key with one MSM and one pairing (see bonk::PairingAccumulator). If the
+     * batch fails and `failing_proofs` is given, it is set to the indices of the proofs that fail on their own.
+     */
+    bool verify_proofs(const std::vector<plonk::proof>& proofs, std::vector<size_t>* failing_proofs = nullptr);
+
+    // Add the pairing claim of `proof` to `accumulator`, or a rejection if its sumcheck fails.
+    void accumulate_proof(const plonk::proof& proof, bonk::PairingAccumulator& accumulator);
+
+    // The KZG claim `proof` reduces to, or nothing if its sumcheck fails.
+    std::optional<pcs::kzg::BilinearAccumulator<pcs::kzg::Params>> reduce_proof(const plonk::proof& proof);
     transcript::Manifest manifest;
 
     std::shared_ptr<bonk::verification_key> key;
@@ -306,4 +306,51 @@ TYPED_TEST(MultivariatesTests, FoldThreeRoundsGenericMultiplePolys)
     }
 }
 
+/*
+ * Folding a polynomial larger than a thread's share, through every round, matches folding it serially: in place while
+ * the folded values fill at least a quarter of folded_polynomials, and into smaller polynomials after that.
+ */
+TYPED_TEST(MultivariatesTests, FoldShrinksMultithreaded)
+{
+    MULTIVARIATES_TESTS_TYPE_ALIASES
+
+    const size_t multivariate_d(14);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::vector<FF> f0(multivariate_n);
+    for (auto& value : f0) {
+        value = FF::random_element();
+    }
+    std::vector<FF> expected_values = f0;
+
+    const size_t num_threads = barretenberg::get_num_threads();
+    barretenberg::set_num_threads(4);
+
+    auto full_polynomials = std::array<std::span<FF>, 1>({ f0 });
+    auto transcript = Transcript(transcript::Manifest());
+    auto sumcheck = Sumcheck<FF, Transcript, ArithmeticRelation>(multivariate_n, transcript);
+
+    size_t folded_size = multivariate_n >> 1;
+    for (size_t round_size = multivariate_n; round_size > 1; round_size >>= 1) {
+        FF round_challenge = FF::random_element();
+        for (size_t i = 0; i < round_size >> 1; ++i) {
+            expected_values[i] =
+                expected_values[2 * i] + round_challenge * (expected_values[2 * i + 1] - expected_values[2 * i]);
+        }
+        if (round_size == multivariate_n) {
+            sumcheck.fold(full_polynomials, round_size, round_challenge);
+        } else {
+            sumcheck.fold(sumcheck.folded_polynomials, round_size, round_challenge);
+        }
+        if (4 * (round_size >> 1) <= folded_size) {
+            folded_size = round_size >> 1;
+        }
+        EXPECT_EQ(sumcheck.folded_polynomials[0].size(), folded_size);
+        for (size_t i = 0; i < round_size >> 1; ++i) {
+            EXPECT_EQ(sumcheck.folded_polynomials[0][i], expected_values[i]);
+        }
+    }
+    barretenberg::set_num_threads(num_threads);
+}
+
 } // namespace test_sumcheck_polynomials
@@ -14,6 +14,26 @@ template <typename FF> class ArithmeticRelation {
     static constexpr size_t RELATION_LENGTH = 4;
     using MULTIVARIATE = StandardHonk::MULTIVARIATE; // could just get from StandardArithmetization
 
+    // The multivariates add_edge_contribution reads: sumcheck extends the edges of these only
+    static constexpr std::array<size_t, 8> COLUMNS = {
+        MULTIVARIATE::W_L,
+        MULTIVARIATE::W_R,
+        MULTIVARIATE::W_O,
+        MULTIVARIATE::Q_M,
+        MULTIVARIATE::Q_L,
+        MULTIVARIATE::Q_R,
+        MULTIVARIATE::Q_O,
+        MULTIVARIATE::Q_C,
+    };
+    // The contribution of an edge on which all of these vanish is zero (no gate), so sumcheck skips it
+    static constexpr std::array<size_t, 5> SELECTORS = {
+        MULTIVARIATE::Q_M,
+        MULTIVARIATE::Q_L,
+        MULTIVARIATE::Q_R,
+        MULTIVARIATE::Q_O,
+        MULTIVARIATE::Q_C,
+    };
+
     /**
      * @brief Expression for the StandardArithmetic gate.
      * @details The relation is defined as C(extended_edges(X)...) =
@@ -11,6 +11,25 @@ template <typename FF> class GrandProductComputationRelation {
     static constexpr size_t RELATION_LENGTH = 5;
     using MULTIVARIATE = StandardHonk::MULTIVARIATE;
 
+    // The multivariates add_edge_contribution reads: sumcheck extends the edges of these only
+    static constexpr std::array<size_t, 13> COLUMNS = {
+        MULTIVARIATE::W_L,
+        MULTIVARIATE::W_R,
+        MULTIVARIATE::W_O,
+        MULTIVARIATE::SIGMA_1,
+        MULTIVARIATE::SIGMA_2,
+        MULTIVARIATE::SIGMA_3,
+        MULTIVARIATE::ID_1,
+        MULTIVARIATE::ID_2,
+        MULTIVARIATE::ID_3,
+        MULTIVARIATE::Z_PERM,
+        MULTIVARIATE::Z_PERM_SHIFT,
+        MULTIVARIATE::LAGRANGE_FIRST,
+        MULTIVARIATE::LAGRANGE_LAST,
+    };
+    // No selector switches this relation off: it holds on every row
+    static constexpr std::array<size_t, 0> SELECTORS = {};
+
     /**
      * @brief Compute contribution of the permutation relation for a given edge (internal function)
      *
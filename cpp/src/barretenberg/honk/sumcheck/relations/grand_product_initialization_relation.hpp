@@ -11,6 +11,11 @@ template <typename FF> class GrandProductInitializationRelation {
     static constexpr size_t RELATION_LENGTH = 3;
     using MULTIVARIATE = StandardHonk::MULTIVARIATE; // could just get from StandardArithmetization
 
+    // The multivariates add_edge_contribution reads: sumcheck extends the edges of these only
+    static constexpr std::array<size_t, 2> COLUMNS = { MULTIVARIATE::Z_PERM_SHIFT, MULTIVARIATE::LAGRANGE_LAST };
+    // The contribution of an edge on which L_LAST vanishes (all but the last) is zero, so sumcheck skips it
+    static constexpr std::array<size_t, 1> SELECTORS = { MULTIVARIATE::LAGRANGE_LAST };
+
     /**
      * @brief Add contribution of the permutation relation for a given edge
      *
@@ -3,6 +3,8 @@
 #include <array>
 #include "barretenberg/honk/utils/public_inputs.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
 #include "sumcheck_round.hpp"
 #include "polynomials/univariate.hpp"
 #include "barretenberg/proof_system/flavor/flavor.hpp"
@@ -52,20 +54,21 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
     *
     * NOTE: With ~40 columns, prob only want to allocate 256 EdgeGroup's at once to keep stack under 1MB?
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
+    *
+    * The folded polynomials are allocated from the polynomial arena by the first fold, at half the size of the full
+    * polynomials, and shrink as the rounds go (see fold), so that the memory they no longer need goes back to the arena.
     */
-    std::array<std::vector<FF>, bonk::StandardArithmetization::NUM_POLYNOMIALS> folded_polynomials;
+    std::array<barretenberg::Polynomial<FF>, bonk::StandardArithmetization::NUM_POLYNOMIALS> folded_polynomials;
+
+    // Smallest range of folded values handed to one thread by fold
+    static constexpr size_t MIN_FOLD_GRAIN_SIZE = 1UL << 10;
 
     // prover instantiates sumcheck with circuit size and transcript
     Sumcheck(size_t multivariate_n, Transcript& transcript)
         : transcript(transcript)
         , multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
-        , round(multivariate_n, std::tuple(Relations<FF>()...))
-    {
-        for (auto& polynomial : folded_polynomials) {
-            polynomial.resize(multivariate_n >> 1);
-        }
-    };
+        , round(multivariate_n, std::tuple(Relations<FF>()...)){};
 
     // verifier instantiates with transcript alone
     explicit Sumcheck(Transcript& transcript)
@@ -75,12 +78,7 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
                    (static_cast<size_t>(buffer[1]) << 16) + (static_cast<size_t>(buffer[0]) << 24);
         }(transcript.get_element("circuit_size")))
         , multivariate_d(numeric::get_msb(multivariate_n))
-        , round(std::tuple(Relations<FF>()...))
-    {
-        for (auto& polynomial : folded_polynomials) {
-            polynomial.resize(multivariate_n >> 1);
-        }
-    };
+        , round(std::tuple(Relations<FF>()...)){};
 
     /**
      * @brief Get all the challenges and computed parameters used in sumcheck in a convenient format
@@ -121,7 +119,7 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
     void execute_prover(auto full_polynomials) // pass by value, not by reference
     {
         // First round
-        // This populates folded_polynomials.
+        // This populates folded_polynomials, reading the full polynomials in place.
 
         const auto relation_parameters = retrieve_proof_parameters();
         PowUnivariate<FF> pow_univariate(relation_parameters.zeta);
@@ -133,10 +131,10 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
         FF round_challenge = FF::serialize_from_buffer(transcript.get_challenge(challenge_label).begin());
         fold(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe fold should do this and release memory?
+        round.round_size = round.round_size >> 1;
 
         // All but final round
-        // We operate on folded_polynomials in place.
+        // We operate on folded_polynomials, which fold shrinks as they halve.
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate = round.compute_univariate(folded_polynomials, relation_parameters, pow_univariate);
@@ -217,18 +215,65 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
      *     g3 -- v6 (1-X0)  X1    X2   --- (v6(1-X0) + v7 X0)   X1    X2  -/
      *        \- v7   X0    X1    X2   --/
      *
+     * The first fold reads the full polynomials, wherever they are, and writes to folded_polynomials, which it
+     * allocates at half their size. Later folds write folded_polynomials over themselves while the result fills at least
+     * a quarter of them. Below that, they write to new polynomials of the result's size, which replace
+     * folded_polynomials, and the old ones go back to the polynomial arena. So the folded polynomials take at most 5/8
+     * of the size of the full polynomials (in the third round), and shrink by a factor of four every other round.
+     *
+     * Folding in place is split into ranges across threads: the folded value i is computed from the values 2i and
+     * 2i + 1, so writing it is safe once the folded values up to i / 2 have been computed. The folded values are
+     * computed in blocks [a, 2a), for doubling a, each split across threads: a block reads [2a, 4a), which no block so
+     * far has written, and overwrites values only the blocks before it read.
+     *
+     * @param polynomials the full polynomials, or folded_polynomials
+     * @param round_size the number of values of each of them still in use
      * @param challenge
      */
     void fold(auto& polynomials, size_t round_size, FF round_challenge)
     {
-        // after the first round, operate in place on folded_polynomials
+        const size_t num_folded_values = round_size >> 1;
+        // Folds only the polynomials there are (some sumcheck tests fold fewer than NUM_POLYNOMIALS)
+        auto fold_range = [&](auto& destination, const size_t start, const size_t end) {
+            for (size_t j = 0; j < polynomials.size(); ++j) {
+                if (polynomials[j].size() == 0) {
+                    continue;
+                }
+                for (size_t i = start; i < end; ++i) {
+                    destination[j][i] =
+                        polynomials[j][2 * i] + round_challenge * (polynomials[j][2 * i + 1] - polynomials[j][2 * i]);
+                }
+            }
+        };
+
+        const bool in_place = static_cast<const void*>(&polynomials) == static_cast<const void*>(&folded_polynomials);
+        if (in_place && 4 * num_folded_values > folded_polynomials[0].size()) {
+            const size_t first_block_size = std::min(num_folded_values, MIN_FOLD_GRAIN_SIZE);
+            fold_range(folded_polynomials, 0, first_block_size);
+            for (size_t block_start = first_block_size; block_start < num_folded_values; block_start *= 2) {
+                const size_t block_size = std::min(block_start, num_folded_values - block_start);
+                barretenberg::parallel_for(
+                    block_size,
+                    [&](const size_t start, const size_t end) {
+                        fold_range(folded_polynomials, block_start + start, block_start + end);
+                    },
+                    MIN_FOLD_GRAIN_SIZE);
+            }
+            return;
+        }
+
+        std::array<barretenberg::Polynomial<FF>, bonk::StandardArithmetization::NUM_POLYNOMIALS> destination;
         for (size_t j = 0; j < polynomials.size(); ++j) {
-            // for (size_t j = 0; j < bonk::StandardArithmetization::NUM_POLYNOMIALS; ++j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                folded_polynomials[j][i >> 1] =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
+            if (polynomials[j].size() != 0) {
+                destination[j] = barretenberg::Polynomial<FF>(num_folded_values);
             }
         }
+        barretenberg::parallel_for(
+            num_folded_values,
+            [&](const size_t start, const size_t end) { fold_range(destination, start, end); },
+            MIN_FOLD_GRAIN_SIZE);
+        // Releases the polynomials folded from, if they were the previous folded_polynomials
+        folded_polynomials = std::move(destination);
     };
 };
 } // namespace honk::sumcheck
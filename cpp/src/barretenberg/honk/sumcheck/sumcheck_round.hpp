@@ -1,8 +1,10 @@
 #pragma once
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <array>
 #include <algorithm>
 #include <tuple>
+#include <vector>
 #include "polynomials/barycentric_data.hpp"
 #include "polynomials/univariate.hpp"
 #include "polynomials/pow.hpp"
@@ -64,13 +66,24 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
 
     // TODO(#224)(Cody): this barycentric stuff should be more built-in?
     std::tuple<BarycentricData<FF, Relations<FF>::RELATION_LENGTH, MAX_RELATION_LENGTH>...> barycentric_utils;
-    std::tuple<Univariate<FF, Relations<FF>::RELATION_LENGTH>...> univariate_accumulators;
+    using RelationUnivariates = std::tuple<Univariate<FF, Relations<FF>::RELATION_LENGTH>...>;
+    // For each relation, the edges of the multivariates extended to the relation's length (only those of the columns
+    // the relation reads are set)
+    using RelationEdges = std::tuple<std::array<Univariate<FF, Relations<FF>::RELATION_LENGTH>, num_multivariates>...>;
+
+    RelationUnivariates univariate_accumulators;
     std::array<FF, NUM_RELATIONS> evaluations;
-    std::array<Univariate<FF, MAX_RELATION_LENGTH>, num_multivariates> extended_edges;
     std::array<Univariate<FF, MAX_RELATION_LENGTH>, NUM_RELATIONS> extended_univariates;
 
-    // TODO(#224)(Cody): this should go away and we should use constexpr method to extend
-    BarycentricData<FF, 2, MAX_RELATION_LENGTH> barycentric_2_to_max = BarycentricData<FF, 2, MAX_RELATION_LENGTH>();
+    // Smallest number of edges worth giving a thread of its own in compute_univariate
+    static constexpr size_t MIN_EDGES_PER_THREAD = 1UL << 6;
+
+    // What each thread of compute_univariate works with: the edges it extends, and the sums over its range of edges
+    struct ThreadAccumulators {
+        RelationUnivariates univariate_accumulators;
+        RelationEdges extended_edges;
+    };
+    std::vector<ThreadAccumulators> thread_accumulators;
 
     // Prover constructor
     SumcheckRound(size_t initial_round_size, auto&& relations)
@@ -92,13 +105,26 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
     /**
      * @brief After computing the round univariate, it is necessary to zero-out the accumulators used to compute it.
      */
-    template <size_t idx = 0> void reset_accumulators()
+    template <size_t idx = 0> void reset_accumulators(RelationUnivariates& accumulators)
     {
-        auto& univariate = std::get<idx>(univariate_accumulators);
+        auto& univariate = std::get<idx>(accumulators);
         std::fill(univariate.evaluations.begin(), univariate.evaluations.end(), FF(0));
 
         if constexpr (idx + 1 < NUM_RELATIONS) {
-            reset_accumulators<idx + 1>();
+            reset_accumulators<idx + 1>(accumulators);
+        }
+    };
+
+    /**
+     * @brief Add the accumulators of another thread to `accumulators`, relation by relation.
+     */
+    template <size_t idx = 0>
+    void add_accumulators(RelationUnivariates& accumulators, const RelationUnivariates& other_accumulators)
+    {
+        std::get<idx>(accumulators) += std::get<idx>(other_accumulators);
+
+        if constexpr (idx + 1 < NUM_RELATIONS) {
+            add_accumulators<idx + 1>(accumulators, other_accumulators);
         }
     };
     // IMPROVEMENT(Cody): This is kind of ugly. There should be a one-liner with folding
@@ -135,22 +161,6 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
         return result;
     }
 
-    /**
-     * @brief Evaluate some relations by evaluating each edge in the edge group at
-     * Univariate::length-many values. Store each value separately in the corresponding
-     * entry of relation_evals.
-     *
-     * @details Should only be called externally with relation_idx equal to 0.
-     *
-     */
-    void extend_edges(auto& multivariates, size_t edge_idx)
-    {
-        for (size_t idx = 0; idx < num_multivariates; idx++) {
-            auto edge = Univariate<FF, 2>({ multivariates[idx][edge_idx], multivariates[idx][edge_idx + 1] });
-            extended_edges[idx] = barycentric_2_to_max.extend(edge);
-        }
-    }
-
     /**
      * @brief After executing each widget on each edge, producing a tuple of univariates of differing lenghths,
      * extend all univariates to the max of the lenghths required by the largest relation.
@@ -172,28 +182,57 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
      * univariate accumulators to be zero.
+     *
+     * @details The edges are split into contiguous ranges, one per thread. Each thread extends its edges and
+     * accumulates their contributions in its own ThreadAccumulators, and the threads' sums are then added up pairwise,
+     * in a tree.
      */
     Univariate<FF, MAX_RELATION_LENGTH> compute_univariate(auto& polynomials,
                                                            const RelationParameters<FF>& relation_parameters,
                                                            const PowUnivariate<FF>& pow_univariate)
     {
-        // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
-        // This means that each univariate for each relation needs an extra multiplication.
-        FF pow_challenge = pow_univariate.partial_evaluation_constant;
-        for (size_t edge_idx = 0; edge_idx < round_size; edge_idx += 2) {
-            extend_edges(polynomials, edge_idx);
-
-            // Compute the i-th edge's univariate contribution,
-            // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
-            // and add it to the accumulators for Sˡ(Xₗ)
-            accumulate_relation_univariates<>(relation_parameters, pow_challenge);
-            // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
-            pow_challenge *= pow_univariate.zeta_pow_sqr;
+        const size_t num_edges = (round_size + 1) >> 1;
+        const size_t num_threads =
+            std::max(std::min(barretenberg::get_num_threads(), num_edges / MIN_EDGES_PER_THREAD), 1UL);
+        const size_t edges_per_thread = (num_edges + num_threads - 1) / num_threads;
+        if (thread_accumulators.size() < num_threads) {
+            thread_accumulators.resize(num_threads);
+        }
+
+        barretenberg::parallel_for(num_threads, [&](const size_t thread_start, const size_t thread_end) {
+            for (size_t thread_idx = thread_start; thread_idx < thread_end; ++thread_idx) {
+                auto& accumulators = thread_accumulators[thread_idx];
+                reset_accumulators<>(accumulators.univariate_accumulators);
+                const size_t start = thread_idx * edges_per_thread;
+                const size_t end = std::min(start + edges_per_thread, num_edges);
+
+                // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
+                // This means that each univariate for each relation needs an extra multiplication.
+                FF pow_challenge =
+                    pow_univariate.partial_evaluation_constant * pow_univariate.zeta_pow_sqr.pow(start);
+                for (size_t edge_idx = 2 * start; edge_idx < 2 * end; edge_idx += 2) {
+                    // Compute the i-th edge's univariate contribution,
+                    // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
+                    // and add it to the accumulators for Sˡ(Xₗ)
+                    accumulate_relation_univariates<>(
+                        accumulators, polynomials, edge_idx, relation_parameters, pow_challenge);
+                    // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
+                    pow_challenge *= pow_univariate.zeta_pow_sqr;
+                }
+            }
+        });
+
+        for (size_t stride = 1; stride < num_threads; stride *= 2) {
+            for (size_t thread_idx = 0; thread_idx + stride < num_threads; thread_idx += 2 * stride) {
+                add_accumulators<>(thread_accumulators[thread_idx].univariate_accumulators,
+                                   thread_accumulators[thread_idx + stride].univariate_accumulators);
+            }
         }
+        univariate_accumulators = thread_accumulators[0].univariate_accumulators;
 
         auto result = batch_over_relations<Univariate<FF, MAX_RELATION_LENGTH>>(relation_parameters.alpha);
 
-        reset_accumulators<>();
+        reset_accumulators<>(univariate_accumulators);
 
         return result;
     }
@@ -272,24 +311,58 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
      *
      * @details In Round l, the univariate S_l computed by the prover is computed as follows:
      *   - Outer loop: iterate through the points on the boolean hypercube of dimension = log(round_size), skipping
-     *                 every other point. On each iteration, create a Univariate<FF, 2> (an 'edge') for each
-     *                 multivariate.
+     *                 every other point. On each iteration, the edge at that point of each multivariate is a
+     *                 Univariate<FF, 2>.
      *   - Inner loop: iterate through the relations, feeding each relation the present collection of edges. Each
      *                 relation adds a contribution
      *
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
      * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
      * appropriate scaling factors, produces S_l.
+     *
+     * Each relation is given the edges of the multivariates it reads (Relation::COLUMNS) only, extended to its own
+     * length only. An edge is linear, so it extends by repeated addition: its values at 0, 1, 2, ... are v0, v1,
+     * v1 + Δ, ... where Δ = v1 - v0. A relation whose Relation::SELECTORS all vanish on the edge contributes zero, and
+     * is skipped.
      */
     template <size_t relation_idx = 0>
-    void accumulate_relation_univariates(const RelationParameters<FF>& relation_parameters, const FF& scaling_factor)
+    void accumulate_relation_univariates(ThreadAccumulators& accumulators,
+                                         auto& polynomials,
+                                         const size_t edge_idx,
+                                         const RelationParameters<FF>& relation_parameters,
+                                         const FF& scaling_factor)
     {
-        std::get<relation_idx>(relations).add_edge_contribution(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        using Relation = std::tuple_element_t<relation_idx, std::tuple<Relations<FF>...>>;
+
+        bool selectors_vanish = !Relation::SELECTORS.empty();
+        for (const size_t selector : Relation::SELECTORS) {
+            if (!polynomials[selector][edge_idx].is_zero() || !polynomials[selector][edge_idx + 1].is_zero()) {
+                selectors_vanish = false;
+                break;
+            }
+        }
+        if (!selectors_vanish) {
+            auto& extended_edges = std::get<relation_idx>(accumulators.extended_edges);
+            for (const size_t column : Relation::COLUMNS) {
+                auto& edge = extended_edges[column];
+                edge.value_at(0) = polynomials[column][edge_idx];
+                edge.value_at(1) = polynomials[column][edge_idx + 1];
+                const FF delta = edge.value_at(1) - edge.value_at(0);
+                for (size_t k = 2; k < Relation::RELATION_LENGTH; ++k) {
+                    edge.value_at(k) = edge.value_at(k - 1) + delta;
+                }
+            }
+            std::get<relation_idx>(relations).add_edge_contribution(
+                std::get<relation_idx>(accumulators.univariate_accumulators),
+                extended_edges,
+                relation_parameters,
+                scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
-            accumulate_relation_univariates<relation_idx + 1>(relation_parameters, scaling_factor);
+            accumulate_relation_univariates<relation_idx + 1>(
+                accumulators, polynomials, edge_idx, relation_parameters, scaling_factor);
         }
     }
 
@@ -301,6 +301,40 @@ TEST(SumcheckRound, ComputeUnivariateProver)
     run_test(/* is_random_input=*/true);
 }
 
+/**
+ * @brief Relations whose selectors vanish on an edge are skipped, which must not change the round univariate; a selector
+ * that vanishes at one end of the edge only does not vanish on it.
+ */
+TEST(SumcheckRound, ComputeUnivariateProverVanishingSelectors)
+{
+    auto run_test = [](const FF& q_c_at_one) {
+        std::array<std::array<FF, input_polynomial_length>, NUM_POLYNOMIALS> input_polynomials;
+        for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+            input_polynomials[i] = { FF::random_element(), FF::random_element() };
+        }
+        for (const size_t selector : { POLYNOMIAL::Q_M, POLYNOMIAL::Q_L, POLYNOMIAL::Q_R, POLYNOMIAL::Q_O }) {
+            input_polynomials[selector] = { 0, 0 };
+        }
+        input_polynomials[POLYNOMIAL::Q_C] = { 0, q_c_at_one };
+        input_polynomials[POLYNOMIAL::LAGRANGE_LAST] = { 0, 0 };
+        const RelationParameters<FF> relation_parameters =
+            RelationParameters<FF>{ .zeta = FF::random_element(),
+                                    .alpha = FF::random_element(),
+                                    .beta = FF::random_element(),
+                                    .gamma = FF::random_element(),
+                                    .public_input_delta = FF::random_element() };
+        auto round_univariate = compute_round_univariate(input_polynomials, relation_parameters);
+        std::array<Univariate<FF, input_polynomial_length>, NUM_POLYNOMIALS> input_univariates;
+        for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+            input_univariates[i] = Univariate<FF, input_polynomial_length>(input_polynomials[i]);
+        }
+        auto expected_round_univariate = compute_expected_round_univariate(input_univariates, relation_parameters);
+        EXPECT_EQ(round_univariate, expected_round_univariate);
+    };
+    run_test(/* q_c_at_one=*/0);
+    run_test(/* q_c_at_one=*/FF::random_element());
+}
+
 TEST(SumcheckRound, ComputeUnivariateVerifier)
 {
     auto run_test = [](bool is_random_input) {
@@ -338,4 +372,48 @@ TEST(SumcheckRound, ComputeUnivariateVerifier)
     run_test(/* is_random_input=*/true);
 }
 
+/**
+ * @brief The round univariate is the same whether its edges are accumulated by one thread or split across several.
+ */
+TEST(SumcheckRound, ComputeUnivariateProverMultithreaded)
+{
+    const size_t round_size = 1UL << 10;
+    std::array<std::vector<FF>, NUM_POLYNOMIALS> polynomials;
+    std::array<std::span<FF>, NUM_POLYNOMIALS> full_polynomials;
+    for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+        polynomials[i].resize(round_size);
+        for (auto& value : polynomials[i]) {
+            value = FF::random_element();
+        }
+        full_polynomials[i] = polynomials[i];
+    }
+    const RelationParameters<FF> relation_parameters =
+        RelationParameters<FF>{ .zeta = FF::random_element(),
+                                .alpha = FF::random_element(),
+                                .beta = FF::random_element(),
+                                .gamma = FF::random_element(),
+                                .public_input_delta = FF::random_element() };
+    const auto compute_round_univariate = [&](const size_t num_threads) {
+        barretenberg::set_num_threads(num_threads);
+        auto round = SumcheckRound<FF,
+                                   NUM_POLYNOMIALS,
+                                   ArithmeticRelation,
+                                   GrandProductComputationRelation,
+                                   GrandProductInitializationRelation>(
+            round_size,
+            std::tuple(ArithmeticRelation<FF>(),
+                       GrandProductComputationRelation<FF>(),
+                       GrandProductInitializationRelation<FF>()));
+        PowUnivariate<FF> pow_zeta(relation_parameters.zeta);
+        return round.compute_univariate(full_polynomials, relation_parameters, pow_zeta);
+    };
+
+    const size_t num_threads = barretenberg::get_num_threads();
+    const auto expected_round_univariate = compute_round_univariate(1);
+    for (const size_t test_num_threads : { 2UL, 3UL, 4UL }) {
+        EXPECT_EQ(compute_round_univariate(test_num_threads), expected_round_univariate);
+    }
+    barretenberg::set_num_threads(num_threads);
+}
+
 } // namespace test_sumcheck_round
@@ -1,10 +1,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <span>
 
-#ifndef NO_MULTITHREADING
-#include "omp.h"
-#endif
 namespace honk::power_polynomial {
 /**
  * @brief Generate the power polynomial vector
@@ -20,35 +17,18 @@ template <typename Fr> barretenberg::Polynomial<Fr> generate_vector(Fr zeta, siz
     // We know the size from the start, so we can allocate exactly the right amount of memory
     barretenberg::Polynomial<Fr> pow_vector(vector_size);
 
-    constexpr size_t usefulness_margin = 4;
-    size_t num_threads = max_threads::compute_num_threads();
-    if (vector_size < (usefulness_margin * num_threads)) {
-        num_threads = 1;
-    }
-    // Prepare for a random number of threads. We need to handle the last thread separately
-    size_t thread_size = vector_size / num_threads;
-    size_t last_thread_size = thread_size;
-    // Check if the vector size is divided into threads cleanly
-    if ((vector_size % thread_size) != 0) {
-        thread_size += 1;
-        last_thread_size = vector_size % thread_size;
-    }
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; i++) {
-        // Exponentiate ζ to the starting power of the chunk
-        Fr starting_power = zeta.pow(i * thread_size);
-        // Set the chunk size depending ontwhether this is the last thread
-        size_t chunk_size = i != (num_threads - 1) ? thread_size : last_thread_size;
-        size_t j = 0;
-        // Go through elements and compute ζ powers
-        for (; j < chunk_size - 1; j++) {
-            pow_vector[i * thread_size + j] = starting_power;
-            starting_power *= zeta;
-        }
-        pow_vector[i * thread_size + j] = starting_power;
-    }
+    // Every range of the vector starts from its own power of ζ
+    constexpr size_t min_grain_size = 1UL << 8;
+    barretenberg::parallel_for(
+        vector_size,
+        [&](const size_t start, const size_t end) {
+            Fr power = zeta.pow(start);
+            for (size_t i = start; i < end; ++i) {
+                pow_vector[i] = power;
+                power *= zeta;
+            }
+        },
+        min_grain_size);
     return pow_vector;
 }
 
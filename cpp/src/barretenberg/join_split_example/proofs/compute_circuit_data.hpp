@@ -6,6 +6,7 @@
 #include <sys/stat.h>
 #include "barretenberg/common/timer.hpp"
 #include "barretenberg/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/proof_system/proving_key/key_file.hpp"
 
 #ifndef __wasm__
 #include <filesystem>
@@ -58,7 +59,7 @@ circuit_data get_circuit_data(std::string const& name,
     BenchmarkInfoCollator benchmark_collator;
 
     auto circuit_key_path = key_path + "/" + path_name;
-    auto pk_path = circuit_key_path + "/proving_key/proving_key";
+    auto pk_path = circuit_key_path + "/proving_key.dat";
     auto vk_path = circuit_key_path + "/verification_key";
     auto padding_path = circuit_key_path + "/padding_proof";
 
@@ -103,12 +104,10 @@ circuit_data get_circuit_data(std::string const& name,
 #endif
 
     if (pk) {
-        auto pk_dir = circuit_key_path + "/proving_key";
         if (exists(pk_path) && load) {
             info(name, ": Loading proving key: ", pk_path);
-            auto pk_stream = std::ifstream(pk_path);
             bonk::proving_key_data pk_data;
-            read_mmap(pk_stream, pk_dir, pk_data);
+            bonk::read_key_file(pk_path, pk_data);
             data.proving_key =
                 std::make_shared<bonk::proving_key>(std::move(pk_data), srs->get_prover_crs(pk_data.circuit_size + 1));
             data.num_gates = pk_data.circuit_size;
@@ -153,13 +152,8 @@ circuit_data get_circuit_data(std::string const& name,
 #ifndef __wasm__
             if (save) {
                 info(name, ": Saving proving key...");
-                std::filesystem::create_directories(pk_dir.c_str());
                 Timer write_timer;
-                std::ofstream os(pk_path);
-                write_mmap(os, pk_dir, *data.proving_key);
-                if (!os.good()) {
-                    throw_or_abort(format("Failed to write: ", pk_path));
-                }
+                bonk::write_key_file(pk_path, *data.proving_key);
                 info(name, ": Saved in ", write_timer.toString(), "s");
             }
 #endif
@@ -329,11 +329,11 @@ std::shared_ptr<verification_key> ComposerBase::compute_verification_key_base(
             selector_poly_coefficients = proving_key->polynomial_store.get(selector_poly_label).get_coefficients();
 
             // Commit to the constraint selector polynomial and insert the commitment in the verification key.
+            auto& runtime_state_pool = scalar_multiplication::get_runtime_state_pool();
             auto selector_poly_commitment = g1::affine_element(
-                scalar_multiplication::pippenger(selector_poly_coefficients,
-                                                 proving_key->reference_string->get_monomial_points(),
-                                                 proving_key->circuit_size,
-                                                 proving_key->pippenger_runtime_state));
+                runtime_state_pool.pippenger(selector_poly_coefficients,
+                                             proving_key->reference_string->get_monomial_points(),
+                                             proving_key->circuit_size));
 
             circuit_verification_key->commitments.insert({ selector_commitment_label, selector_poly_commitment });
         }
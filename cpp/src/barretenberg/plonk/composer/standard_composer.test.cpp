@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/pedersen/pedersen.hpp"
 #include "barretenberg/crypto/pedersen/generator_data.hpp"
 #include "barretenberg/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/plonk/proof_system/prover/prover_pool.hpp"
 
 using namespace barretenberg;
 using namespace bonk;
@@ -719,4 +720,144 @@ TEST(standard_composer, test_fixed_group_add_gate)
 
     EXPECT_EQ(result, true);
 }
+// Large enough (circuit size 2^16) that the FFTs take the four-step path, while the work queue runs the IFFTs of the
+// wires concurrently
+TEST(standard_composer, large_circuit_proof)
+{
+    StandardComposer composer = StandardComposer();
+    fr a = fr::random_element();
+    fr b = fr::random_element();
+    uint32_t a_idx = composer.add_public_variable(a);
+    uint32_t b_idx = composer.add_variable(b);
+    for (size_t i = 0; i < (1UL << 15) + 1; ++i) {
+        const fr c = a * b + a;
+        const uint32_t c_idx = composer.add_variable(c);
+        composer.create_poly_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::zero(), fr::neg_one(), fr::zero() });
+        a = b;
+        a_idx = b_idx;
+        b = c;
+        b_idx = c_idx;
+    }
+
+    auto prover = composer.create_prover();
+    auto verifier = composer.create_verifier();
+    EXPECT_EQ(prover.key->circuit_size, 1UL << 16);
+
+    proof proof = prover.construct_proof();
+
+    EXPECT_EQ(verifier.verify_proof(proof), true);
+}
+
+TEST(standard_composer, prover_pool)
+{
+    // (a, b) <- (b, a * b + a), 2048 times over (4096 gates), with the final value public. The proofs share the FFT
+    // and MSM machinery while they run, which a circuit this size exercises at every round
+    constexpr size_t num_rounds = 2048;
+    const auto build_circuit = [](StandardComposer& composer, fr a, fr b) {
+        uint32_t a_idx = composer.add_variable(a);
+        uint32_t b_idx = composer.add_variable(b);
+        for (size_t i = 0; i < num_rounds; ++i) {
+            const fr c = a * b + a;
+            const uint32_t ab_idx = composer.add_variable(a * b);
+            const uint32_t c_idx = (i + 1 == num_rounds) ? composer.add_public_variable(c) : composer.add_variable(c);
+            composer.create_mul_gate({ a_idx, b_idx, ab_idx, fr::one(), fr::neg_one(), fr::zero() });
+            composer.create_add_gate({ ab_idx, a_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+            a = b;
+            a_idx = b_idx;
+            b = c;
+            b_idx = c_idx;
+        }
+    };
+
+    StandardComposer composer = StandardComposer();
+    build_circuit(composer, fr::random_element(), fr::random_element());
+    ProverPool<Prover> pool(composer.compute_proving_key(), 2);
+
+    constexpr size_t num_proofs = 4;
+    std::vector<Prover> provers;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        StandardComposer instance(pool.create_proof_key(), nullptr);
+        build_circuit(instance, fr::random_element(), fr::random_element());
+        provers.push_back(instance.create_prover());
+    }
+
+    auto proofs = pool.construct_proofs(provers);
+    EXPECT_EQ(proofs.size(), num_proofs);
+    auto verifier = composer.create_verifier();
+    for (auto& proof : proofs) {
+        EXPECT_EQ(verifier.verify_proof(proof), true);
+    }
+}
+
+TEST(standard_composer, verify_proofs)
+{
+    // c = a * b + a, public
+    const auto build_circuit = [](StandardComposer& composer, const fr& a, const fr& b) {
+        const uint32_t a_idx = composer.add_variable(a);
+        const uint32_t b_idx = composer.add_variable(b);
+        const uint32_t ab_idx = composer.add_variable(a * b);
+        const uint32_t c_idx = composer.add_public_variable(a * b + a);
+        composer.create_mul_gate({ a_idx, b_idx, ab_idx, fr::one(), fr::neg_one(), fr::zero() });
+        composer.create_add_gate({ ab_idx, a_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+    };
+
+    StandardComposer composer = StandardComposer();
+    build_circuit(composer, fr::random_element(), fr::random_element());
+    ProverPool<Prover> pool(composer.compute_proving_key(), 1);
+
+    constexpr size_t num_proofs = 5;
+    std::vector<Prover> provers;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        StandardComposer instance(pool.create_proof_key(), nullptr);
+        build_circuit(instance, fr::random_element(), fr::random_element());
+        provers.push_back(instance.create_prover());
+    }
+    auto proofs = pool.construct_proofs(provers);
+
+    auto verifier = composer.create_verifier();
+    EXPECT_EQ(verifier.verify_proofs(proofs), true);
+
+    // swap two of the proofs' public inputs: each proof still parses, but neither verifies
+    std::swap_ranges(&proofs[1].proof_data[0], &proofs[1].proof_data[32], &proofs[3].proof_data[0]);
+    std::vector<size_t> failing_proofs;
+    EXPECT_EQ(verifier.verify_proofs(proofs, &failing_proofs), false);
+    EXPECT_EQ(failing_proofs, std::vector<size_t>({ 1, 3 }));
+    EXPECT_EQ(verifier.verify_proof(proofs[0]), true);
+    EXPECT_EQ(verifier.verify_proof(proofs[1]), false);
+}
+
+TEST(standard_composer, verify_proofs_large_batch)
+{
+    // Each proof brings its own nine commitments to the batch's MSMs, so 48 proofs add over 400 distinct points: enough
+    // for the batched pippenger to use 7-bit buckets
+    const auto build_circuit = [](StandardComposer& composer, const fr& a, const fr& b) {
+        const uint32_t a_idx = composer.add_variable(a);
+        const uint32_t b_idx = composer.add_variable(b);
+        const uint32_t ab_idx = composer.add_variable(a * b);
+        const uint32_t c_idx = composer.add_public_variable(a * b + a);
+        composer.create_mul_gate({ a_idx, b_idx, ab_idx, fr::one(), fr::neg_one(), fr::zero() });
+        composer.create_add_gate({ ab_idx, a_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+    };
+
+    StandardComposer composer = StandardComposer();
+    build_circuit(composer, fr::random_element(), fr::random_element());
+    ProverPool<Prover> pool(composer.compute_proving_key(), 1);
+
+    constexpr size_t num_proofs = 48;
+    std::vector<Prover> provers;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        StandardComposer instance(pool.create_proof_key(), nullptr);
+        build_circuit(instance, fr::random_element(), fr::random_element());
+        provers.push_back(instance.create_prover());
+    }
+    auto proofs = pool.construct_proofs(provers);
+
+    auto verifier = composer.create_verifier();
+    EXPECT_EQ(verifier.verify_proofs(proofs), true);
+
+    std::swap_ranges(&proofs[7].proof_data[0], &proofs[7].proof_data[32], &proofs[40].proof_data[0]);
+    std::vector<size_t> failing_proofs;
+    EXPECT_EQ(verifier.verify_proofs(proofs, &failing_proofs), false);
+    EXPECT_EQ(failing_proofs, std::vector<size_t>({ 7, 40 }));
+}
 } // namespace plonk
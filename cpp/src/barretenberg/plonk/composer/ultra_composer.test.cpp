@@ -115,6 +115,52 @@ TEST(ultra_composer, create_gates_from_plookup_accumulators)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_composer, quotient_in_blocks)
+{
+    // a zero target stands for the size of the coset evaluations of all polynomials on half of the coset
+    const auto prove_and_verify = [](const size_t target_bytes, const bool drop_coset_ffts) {
+        UltraComposer composer = UltraComposer();
+
+        const fr input_value = uint256_t(fr::random_element()).slice(0, 126);
+        const auto input_index = composer.add_variable(input_value);
+        const auto sequence_data = plookup::get_lookup_accumulators(MultiTableId::PEDERSEN_LEFT_LO, input_value);
+        composer.create_gates_from_plookup_accumulators(MultiTableId::PEDERSEN_LEFT_LO, sequence_data, input_index);
+
+        auto indices = add_variables(composer, { 1, 2, 3, 4, 5, 6, 7, 8 });
+        for (size_t i = 0; i < indices.size(); i++) {
+            composer.create_new_range_constraint(indices[i], 8);
+        }
+        composer.create_sort_constraint(indices);
+
+        auto prover = composer.create_prover();
+        auto verifier = composer.create_verifier();
+
+        // without coset FFTs in the proving key, every coset evaluation comes from a monomial form
+        auto& key = prover.key;
+        for (size_t i = 0; drop_coset_ffts && i < key->polynomial_manifest.size(); ++i) {
+            const std::string label = std::string(key->polynomial_manifest[i].polynomial_label) + "_fft";
+            if (key->polynomial_manifest[i].source != PolynomialSource::WITNESS &&
+                key->polynomial_store.contains(label)) {
+                key->polynomial_store.remove(label);
+            }
+        }
+        // the coset evaluations of all the polynomials of the manifest and L_1 on half of the coset
+        const size_t half_coset_size_in_bytes =
+            (key->polynomial_manifest.size() + 1) * 2 * key->circuit_size * sizeof(fr);
+
+        prover.set_quotient_block_target(target_bytes == 0 ? half_coset_size_in_bytes : target_bytes);
+        proof proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    };
+
+    // a single block, then four blocks gathered from the proving key's coset FFTs
+    prove_and_verify(SIZE_MAX, false);
+    prove_and_verify(1, false);
+    // two and four blocks evaluated from monomial forms
+    prove_and_verify(0, true);
+    prove_and_verify(1, true);
+}
+
 TEST(ultra_composer, test_no_lookup_proof)
 {
     UltraComposer composer = UltraComposer();
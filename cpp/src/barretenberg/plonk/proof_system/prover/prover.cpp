@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <algorithm>
 
 using namespace barretenberg;
 
@@ -35,6 +36,7 @@ ProverBase<settings>::ProverBase(ProverBase<settings>&& other)
     , commitment_scheme(std::move(other.commitment_scheme))
     , queue(key.get(), &transcript)
 {
+    set_quotient_block_target(other.quotient_block_target_bytes);
     for (size_t i = 0; i < other.random_widgets.size(); ++i) {
         random_widgets.emplace_back(std::move(other.random_widgets[i]));
     }
@@ -60,6 +62,7 @@ template <typename settings> ProverBase<settings>& ProverBase<settings>::operato
     commitment_scheme = std::move(other.commitment_scheme);
 
     queue = work_queue(key.get(), &transcript);
+    set_quotient_block_target(other.quotient_block_target_bytes);
     return *this;
 }
 
@@ -399,23 +402,14 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
 #endif
     fr alpha_base = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
 
-    // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
-    compute_lagrange_1_fft();
+    if (quotient_block_target_bytes == 0) {
+        // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
+        compute_lagrange_1_fft();
 
-    for (auto& widget : random_widgets) {
-#ifdef DEBUG_TIMING
-        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
-#endif
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-#ifdef DEBUG_TIMING
-        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-        std::chrono::milliseconds diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-        std::cerr << "widget " << i << " quotient compute time: " << diff.count() << "ms" << std::endl;
-#endif
-    }
-
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
+        // the whole 4n coset is a single block
+        alpha_base = compute_quotient_contributions(alpha_base, { key->large_domain, key->large_domain, 0 });
+    } else {
+        alpha_base = compute_quotient_contributions_in_blocks(alpha_base);
     }
 
 #ifdef DEBUG_TIMING
@@ -546,9 +540,173 @@ template <typename settings> void ProverBase<settings>::add_blinding_to_quotient
     }
 }
 
+/**
+ * Add the contributions of all widgets to the quotient polynomial, at the points of one block of the 4n coset.
+ *
+ * @return The power of alpha that follows the last widget's.
+ * */
+template <typename settings>
+fr ProverBase<settings>::compute_quotient_contributions(const fr& alpha_base, const quotient_block& block)
+{
+    fr alpha = alpha_base;
+    for (auto& widget : random_widgets) {
+#ifdef DEBUG_TIMING
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+#endif
+        alpha = widget->compute_quotient_contribution(alpha, transcript, block);
+#ifdef DEBUG_TIMING
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        std::chrono::milliseconds diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cerr << "widget " << i << " quotient compute time: " << diff.count() << "ms" << std::endl;
+#endif
+    }
+
+    for (auto& widget : transition_widgets) {
+        alpha = widget->compute_quotient_contribution(alpha, transcript, block);
+    }
+    return alpha;
+}
+
+/**
+ * Add the contributions of all widgets to the quotient polynomial one block of the 4n coset at a time, splitting the
+ * coset into as few blocks (1, 2 or 4) as keep the block's coset evaluations within `quotient_block_target_bytes`, or
+ * into 4 blocks if none do.
+ *
+ * While a block is processed, the store holds its coset evaluations under the usual "<label>_fft" labels:
+ * - the wires and grand products, whose FFT work items the queue deferred, and the polynomials of the proving key that
+ *   have no coset FFT, are evaluated from their monomial forms by an FFT of size 4n / num_blocks;
+ * - the coset FFTs of the proving key are read in place by a single block, and otherwise gathered block by block
+ *   (the key's own are put back at the end, lazily mapped ones as lazy entries);
+ * - L_1 is evaluated directly.
+ * A proving key without coset FFTs thus bounds the memory of the whole quotient construction, at the price of
+ * recomputing them for every proof.
+ * */
+template <typename settings> fr ProverBase<settings>::compute_quotient_contributions_in_blocks(const fr& alpha_base)
+{
+    const std::vector<std::string> deferred_labels = queue.release_deferred_ffts();
+    std::vector<std::string> monomial_labels(deferred_labels);
+    std::vector<std::string> coset_labels;
+    for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
+        const std::string label(key->polynomial_manifest[i].polynomial_label);
+        if (std::find(deferred_labels.begin(), deferred_labels.end(), label) != deferred_labels.end()) {
+            continue;
+        }
+        if (key->polynomial_store.contains(label + "_fft")) {
+            coset_labels.push_back(label);
+        } else if (key->polynomial_store.contains(label)) {
+            monomial_labels.push_back(label);
+        }
+    }
+
+    // coset evaluations held at a time: those of the monomial forms and of L_1, and copies of the key's coset FFTs
+    // unless there is a single block
+    const size_t large_domain_size = key->large_domain.size;
+    const auto get_block_size_in_bytes = [&](const size_t num_blocks) {
+        const size_t num_polynomials = monomial_labels.size() + 1 + (num_blocks > 1 ? coset_labels.size() : 0);
+        return num_polynomials * (large_domain_size / num_blocks) * sizeof(fr);
+    };
+    size_t num_blocks = 1;
+    while (num_blocks < 4 && get_block_size_in_bytes(num_blocks) > quotient_block_target_bytes) {
+        num_blocks *= 2;
+    }
+
+    // the subgroups of order 4n and n already have their root tables
+    evaluation_domain mid_domain;
+    const evaluation_domain* block_domain = &key->large_domain;
+    if (num_blocks == 2) {
+        mid_domain = evaluation_domain(2 * circuit_size);
+        mid_domain.compute_lookup_table();
+        block_domain = &mid_domain;
+    } else if (num_blocks == 4) {
+        block_domain = &key->small_domain;
+    }
+    const size_t block_size = block_domain->size;
+
+    // The key's coset FFTs are set aside while the block copies take their labels. Those of a lazily mapped key are
+    // held as mappings, and registered for lazy mapping again at the end, so the key does not come out of the proof
+    // holding them resident.
+    std::vector<polynomial> key_coset_ffts;
+    std::vector<std::string> key_coset_fft_filenames;
+    if (num_blocks > 1) {
+        for (const auto& label : coset_labels) {
+            key_coset_fft_filenames.push_back(key->polynomial_store.get_lazy_filename(label + "_fft"));
+            key_coset_ffts.push_back(std::move(key->polynomial_store.get(label + "_fft")));
+        }
+    }
+
+    fr alpha = alpha_base;
+    for (size_t b = 0; b < num_blocks; ++b) {
+        const quotient_block block(key->large_domain, *block_domain, b);
+        // the first point of the block is x = g.ω^b, and X^{block_size} takes the value x^{block_size} on the block
+        const fr first_point = key->large_domain.generator * block.generator_shift;
+        const fr fold_factor = first_point.pow(static_cast<uint64_t>(block_size));
+
+        // The coset evaluations of p(X) are the FFT of the coefficients of p(x.X) reduced modulo X^{block_size} - 1
+        std::vector<polynomial> block_ffts;
+        std::vector<fr*> coefficients;
+        for (const auto& label : monomial_labels) {
+            const polynomial& monomial = key->polynomial_store.get(label);
+            polynomial& block_fft = block_ffts.emplace_back(block_size);
+            parallel_for(
+                block_size,
+                [&](const size_t start, const size_t end) {
+                    fr power = first_point.pow(static_cast<uint64_t>(start));
+                    for (size_t i = start; i < end; ++i) {
+                        fr folded_power = power;
+                        for (size_t k = i; k < monomial.size(); k += block_size) {
+                            block_fft[i] += monomial[k] * folded_power;
+                            folded_power *= fold_factor;
+                        }
+                        power *= first_point;
+                    }
+                },
+                ITERATE_OVER_DOMAIN_MIN_GRAIN_SIZE);
+            coefficients.push_back(block_fft.get_coefficients());
+        }
+        polynomial_arithmetic::fft_batch(coefficients, *block_domain);
+        for (size_t i = 0; i < monomial_labels.size(); ++i) {
+            key->polynomial_store.put(monomial_labels[i] + "_fft", std::move(block_ffts[i]));
+        }
+
+        for (size_t k = 0; k < key_coset_ffts.size(); ++k) {
+            const polynomial& coset_fft = key_coset_ffts[k];
+            polynomial block_fft(block_size);
+            ITERATE_OVER_DOMAIN_START((*block_domain));
+            block_fft[i] = coset_fft[block.get_large_domain_index(i)];
+            ITERATE_OVER_DOMAIN_END;
+            key->polynomial_store.put(coset_labels[k] + "_fft", std::move(block_fft));
+        }
+
+        polynomial lagrange_1_fft(block_size);
+        polynomial_arithmetic::compute_lagrange_polynomial_fft(
+            lagrange_1_fft.get_coefficients(), key->small_domain, *block_domain, block.generator_shift);
+        key->polynomial_store.put("lagrange_1_fft", std::move(lagrange_1_fft));
+
+        alpha = compute_quotient_contributions(alpha_base, block);
+    }
+
+    for (const auto& label : monomial_labels) {
+        key->polynomial_store.remove(label + "_fft");
+    }
+    key->polynomial_store.remove("lagrange_1_fft");
+    for (size_t i = 0; i < key_coset_ffts.size(); ++i) {
+        if (key_coset_fft_filenames[i].empty()) {
+            key->polynomial_store.put(coset_labels[i] + "_fft", std::move(key_coset_ffts[i]));
+        } else {
+            key->polynomial_store.put_lazy(coset_labels[i] + "_fft", key_coset_fft_filenames[i]);
+        }
+    }
+    return alpha;
+}
+
 // Compute FFT of lagrange polynomial L_1 needed in random widgets only
 template <typename settings> void ProverBase<settings>::compute_lagrange_1_fft()
 {
+    // L_1 depends only on the domains, so a key keeps it from one proof to the next; the keys of a ProverPool share
+    // the one their precomputed key holds
+    if (key->polynomial_store.contains("lagrange_1_fft")) {
+        return;
+    }
     polynomial lagrange_1_fft(4 * circuit_size + 8);
     polynomial_arithmetic::compute_lagrange_polynomial_fft(
         lagrange_1_fft.get_coefficients(), key->small_domain, key->large_domain);
@@ -566,6 +724,9 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
 {
+    // queue.get_round_timings() then holds the timings of this proof's rounds
+    queue.reset_round_timings();
+
     // Execute init round. Randomize witness polynomials.
     execute_preamble_round();
     queue.process_queue();
@@ -582,21 +743,39 @@ template <typename settings> plonk::proof& ProverBase<settings>::construct_proof
     // and fft the witnesses
     execute_third_round();
     queue.process_queue();
+    release_precomputed_polynomials("_lagrange");
 
     // Fiat-Shamir alpha, compute & commit to quotient polynomial.
     execute_fourth_round();
     queue.process_queue();
+    release_precomputed_polynomials("_fft");
 
     execute_fifth_round();
 
     execute_sixth_round();
     queue.process_queue();
+    release_precomputed_polynomials("");
 
     queue.flush_queue();
 
     return export_proof();
 }
 
+/**
+ * @brief Unmap the precomputed polynomials of one form ("_lagrange", "_fft", or "" for the monomial form) once the rest
+ * of the proof no longer reads them. This only affects a key read lazily (see read_mmap); its polynomials are mapped
+ * again when the next proof asks for them.
+ */
+template <typename settings> void ProverBase<settings>::release_precomputed_polynomials(const std::string& form_suffix)
+{
+    for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
+        const auto& entry = key->polynomial_manifest[i];
+        if (entry.source == PolynomialSource::SELECTOR || entry.source == PolynomialSource::PERMUTATION) {
+            key->polynomial_store.release(std::string(entry.polynomial_label) + form_suffix);
+        }
+    }
+}
+
 template <typename settings> void ProverBase<settings>::reset()
 {
     transcript::Manifest manifest = transcript.get_manifest();
@@ -43,6 +43,19 @@ template <typename settings> class ProverBase {
 
     size_t get_circuit_size() const { return circuit_size; }
 
+    /**
+     * Construct the quotient polynomial one block of the 4n coset at a time (see quotient_block), rather than keeping
+     * the 4n coset FFTs of the wires and grand products for the whole proof. The coset is split into 1, 2 or 4 blocks:
+     * the fewest whose coset evaluations take at most `target_bytes`, or 4 if none do. This picks the block count
+     * and is not a bound on memory; it is only as fine grained as the three block counts. Zero, the default, disables
+     * blocking.
+     */
+    void set_quotient_block_target(const size_t target_bytes)
+    {
+        quotient_block_target_bytes = target_bytes;
+        queue.set_defer_ffts(target_bytes != 0);
+    }
+
     void flush_queued_work_items() { queue.flush_queue(); }
 
     work_queue::work_item_info get_queued_work_item_info() const { return queue.get_queued_work_item_info(); }
@@ -96,7 +109,12 @@ template <typename settings> class ProverBase {
     work_queue queue;
 
   private:
+    barretenberg::fr compute_quotient_contributions(const barretenberg::fr& alpha_base, const quotient_block& block);
+    barretenberg::fr compute_quotient_contributions_in_blocks(const barretenberg::fr& alpha_base);
+    void release_precomputed_polynomials(const std::string& form_suffix);
+
     plonk::proof proof;
+    size_t quotient_block_target_bytes = 0;
 };
 extern template class ProverBase<standard_settings>;
 extern template class ProverBase<turbo_settings>;
@@ -302,3 +302,59 @@ TEST(prover, compute_quotient_polynomial)
         EXPECT_EQ((state.key->quotient_polynomial_parts[3].at(i) == fr::zero()), true);
     }
 }
+
+TEST(prover, work_queue_round_timings)
+{
+    plonk::Prover state = prover_helpers::generate_test_data(1 << 10);
+    state.execute_preamble_round();
+    state.queue.process_queue();
+    state.execute_first_round();
+    state.queue.process_queue();
+    state.execute_second_round();
+    state.queue.process_queue();
+    state.execute_third_round();
+    state.queue.process_queue();
+    state.queue.flush_queue();
+
+    // one entry for each call to process_queue
+    const auto& timings = state.queue.get_round_timings();
+    EXPECT_EQ(timings.size(), 4UL);
+    // the wires' IFFTs, their commitments and the grand product commitment alongside the wires' FFTs
+    EXPECT_GT(timings[0].iffts, 0);
+    EXPECT_GT(timings[1].scalar_multiplications, 0);
+    EXPECT_GT(timings[3].scalar_multiplications, 0);
+    EXPECT_GT(timings[3].ffts, 0);
+    for (const auto& round : timings) {
+        EXPECT_GE(round.get_overlap(), 0);
+    }
+}
+
+TEST(prover, work_queue_fft_waits_for_ifft)
+{
+    constexpr size_t n = 1 << 10;
+    plonk::Prover state = prover_helpers::generate_test_data(n);
+    auto& store = state.key->polynomial_store;
+
+    polynomial expected(store.get("w_1_lagrange"), n);
+    expected.ifft(state.key->small_domain);
+    polynomial expected_fft(expected, 4 * n + 4);
+    expected_fft.coset_fft(state.key->large_domain);
+
+    // the FFT starts from the monomial form that the IFFT, queued in the same round, computes
+    state.queue.add_to_queue({ work_queue::WorkType::IFFT, nullptr, "w_1", 0, 0 });
+    state.queue.add_to_queue({ work_queue::WorkType::FFT, nullptr, "w_1", 0, 0 });
+    state.queue.process_queue();
+    state.queue.flush_queue();
+
+    const polynomial& w_1 = store.get("w_1");
+    const polynomial& w_1_fft = store.get("w_1_fft");
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(w_1[i], expected[i]);
+    }
+    for (size_t i = 0; i < 4 * n; ++i) {
+        EXPECT_EQ(w_1_fft[i], expected_fft[i]);
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(w_1_fft[4 * n + i], expected_fft[i]);
+    }
+}
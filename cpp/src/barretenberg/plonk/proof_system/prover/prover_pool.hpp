@@ -0,0 +1,75 @@
+#pragma once
+#include "prover.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+
+namespace plonk {
+
+/**
+ * Proves many instances of one circuit, several at a time, sharing the circuit's proving key.
+ *
+ * Every proof is made with a key from create_proof_key(), whose precomputed polynomials (selectors, permutations,
+ * their coset FFTs, L_1) are read only views of the shared key's: only the witness, and the polynomials the prover
+ * computes from it, are the proof's own. The caller builds the prover of each proof on such a key, typically with a
+ * composer constructed from the key, whose compute_witness then writes the proof's witness into it.
+ *
+ * construct_proofs runs up to `max_concurrent_proofs` provers at once. The proofs in flight share the SRS, the
+ * pippenger runtime states and the process-wide thread pool, whose idle threads steal work from whichever proof has
+ * most; each proof gets about get_num_threads() / max_concurrent_proofs threads' worth of it. One proof at a time gives
+ * every thread to each proof in turn, which is the way to prove with least latency; more raises the throughput where a
+ * single proof cannot keep every thread busy (its serial parts, and its rounds' smaller loops).
+ */
+template <typename Prover> class ProverPool {
+  public:
+    ProverPool(std::shared_ptr<proving_key> const& key, const size_t max_concurrent_proofs)
+        : key_(key)
+        , max_concurrent_proofs_(std::max(max_concurrent_proofs, 1UL))
+    {
+        // computed once here, rather than by every proof
+        Prover(key_, transcript::Manifest()).compute_lagrange_1_fft();
+    }
+
+    std::shared_ptr<proving_key> create_proof_key() const { return std::make_shared<proving_key>(key_); }
+
+    size_t get_max_concurrent_proofs() const { return max_concurrent_proofs_; }
+
+    void set_max_concurrent_proofs(const size_t max_concurrent_proofs)
+    {
+        max_concurrent_proofs_ = std::max(max_concurrent_proofs, 1UL);
+    }
+
+    /**
+     * Construct the proofs of `provers`, each made with a key from create_proof_key(), and return them in order.
+     */
+    std::vector<plonk::proof> construct_proofs(std::vector<Prover>& provers) const
+    {
+        std::vector<plonk::proof> proofs(provers.size());
+        std::atomic<size_t> next_proof = 0;
+        const auto prove = [&]() {
+            for (size_t i = next_proof++; i < provers.size(); i = next_proof++) {
+                proofs[i] = provers[i].construct_proof();
+            }
+        };
+#ifndef NO_MULTITHREADING
+        std::vector<std::future<void>> workers;
+        for (size_t i = 1; i < std::min(max_concurrent_proofs_, provers.size()); ++i) {
+            workers.push_back(std::async(std::launch::async, prove));
+        }
+        prove();
+        for (auto& worker : workers) {
+            worker.get();
+        }
+#else
+        prove();
+#endif
+        return proofs;
+    }
+
+  private:
+    std::shared_ptr<proving_key> key_;
+    size_t max_concurrent_proofs_;
+};
+
+} // namespace plonk
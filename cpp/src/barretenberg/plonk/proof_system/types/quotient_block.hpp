@@ -0,0 +1,44 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/polynomials/evaluation_domain.hpp"
+
+namespace plonk {
+
+/**
+ * @brief A block of the coset on which the prover evaluates the quotient polynomial
+ *
+ * @details The quotient identities are evaluated at the points g.ω^i, i = 0, ..., 4n - 1, where ω is the 4n'th root
+ * of unity. Block `index` of `num_blocks` holds the points g.ω^{index + num_blocks.j}, j = 0, ..., 4n / num_blocks
+ * - 1.
+ * These form the coset g.ω^index.H' of the subgroup H' of order 4n / num_blocks (the subgroup of `domain`), so the
+ * evaluations of a polynomial on the block are a coset FFT over `domain` with generator shift ω^index.
+ *
+ * Multiplying X by the n'th root of unity moves 4 / num_blocks places along a block, which is why a block never needs
+ * the evaluations of another one and why there are at most 4 blocks. A single block is the whole 4n coset.
+ */
+struct quotient_block {
+    quotient_block(const barretenberg::evaluation_domain& large_domain,
+                   const barretenberg::evaluation_domain& block_domain,
+                   const size_t block_index)
+        : domain(block_domain)
+        , index(block_index)
+        , num_blocks(large_domain.size / block_domain.size)
+        , index_shift(4 / num_blocks)
+        , generator_shift(large_domain.root.pow(static_cast<uint64_t>(block_index)))
+    {
+        ASSERT(num_blocks > 0 && num_blocks <= 4 && index < num_blocks);
+    }
+
+    // position of the j'th point of the block in the 4n coset
+    size_t get_large_domain_index(const size_t j) const { return index + num_blocks * j; }
+
+    const barretenberg::evaluation_domain& domain;
+    size_t index;
+    size_t num_blocks;
+    // the shift X -> ω_n.X, in points of the block
+    size_t index_shift;
+    // ω^index
+    barretenberg::fr generator_shift;
+};
+
+} // namespace plonk
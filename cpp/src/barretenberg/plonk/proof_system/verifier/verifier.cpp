@@ -3,9 +3,6 @@
 #include "./verifier.hpp"
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
-#include "barretenberg/ecc/curves/bn254/fq12.hpp"
-#include "barretenberg/ecc/curves/bn254/pairing.hpp"
-#include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
 using namespace barretenberg;
@@ -38,7 +35,39 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
 
 template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
 {
-    // This function verifies a PLONK proof for given program settings.
+    bonk::PairingAccumulator accumulator(key->reference_string->get_precomputed_g2_lines());
+    accumulate_proof(proof, accumulator);
+    return accumulator.verify();
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_proofs(const std::vector<plonk::proof>& proofs,
+                                                   std::vector<size_t>* failing_proofs)
+{
+    bonk::PairingAccumulator accumulator(key->reference_string->get_precomputed_g2_lines());
+    for (const auto& proof : proofs) {
+        accumulate_proof(proof, accumulator);
+    }
+    if (accumulator.verify()) {
+        return true;
+    }
+    if (failing_proofs != nullptr) {
+        *failing_proofs = accumulator.get_failing_claims();
+    }
+    return false;
+}
+
+template <typename program_settings>
+void VerifierBase<program_settings>::accumulate_proof(const plonk::proof& proof,
+                                                      bonk::PairingAccumulator& accumulator)
+{
+    accumulator.add_claim(compute_pairing_claim(proof));
+}
+
+template <typename program_settings>
+bonk::PairingClaim VerifierBase<program_settings>::compute_pairing_claim(const plonk::proof& proof)
+{
+    // This function reduces a PLONK proof for given program settings to the pairing check that verifies it.
     // A PLONK proof for standard PLONK is of the form:
     //
     // π_SNARK =   { [a]_1,[b]_1,[c]_1,[z]_1,[t_{low}]_1,[t_{mid}]_1,[t_{high}]_1,[W_z]_1,[W_zω]_1 \in G,
@@ -48,6 +77,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Proof π_SNARK must first be added to the transcript with the other program_settings.
 
     key->program_width = program_settings::program_width;
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
 
     // Add the proof data to the transcript, according to the manifest. Also initialise the transcript's hash type and
     // challenge bytes.
@@ -163,26 +194,18 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
+    // The pairing check of step 12 is e(P[0], [1]_2).e(P[1], [x]_2) == 1, where P[0] is the MSM of the accumulated
+    // scalars and group elements and P[1] = -(u.[W_zω]_1 + [W_z]_1). Both are left unevaluated, so that a batch of
+    // proofs can be checked with one MSM and one pairing.
+    bonk::PairingClaim claim;
     for (const auto& [key, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            claim.add_lhs_term(kate_fr_elements.at(key), value);
         }
     }
-
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table(&elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    claim.add_rhs_term(-separator_challenge, PI_Z_OMEGA);
+    claim.add_rhs_term(-fr::one(), PI_Z);
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -219,22 +242,11 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        claim.add_lhs_term(recursion_separator_challenge, g1::affine_element(x0, y0));
+        claim.add_rhs_term(recursion_separator_challenge, g1::affine_element(x1, y1));
     }
 
-    g1::element::batch_normalize(P, 2);
-
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
-
-    // The final pairing check of step 12.
-    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
-
-    return (result == barretenberg::fq12::one());
+    return claim;
 }
 
 template class VerifierBase<standard_verifier_settings>;
@@ -4,6 +4,7 @@
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "barretenberg/transcript/manifest.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
+#include "barretenberg/proof_system/pairing_accumulator/pairing_accumulator.hpp"
 
 namespace plonk {
 template <typename program_settings> class VerifierBase {
@@ -20,6 +21,17 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * Verify a batch of proofs against the key with one MSM and one pairing (see bonk::PairingAccumulator). If the
+     * batch fails and `failing_proofs` is given, it is set to the indices of the proofs that fail on their own.
+     */
+    bool verify_proofs(const std::vector<plonk::proof>& proofs, std::vector<size_t>* failing_proofs = nullptr);
+
+    // Add the pairing claim of `proof` to `accumulator`, to be checked together with other proofs'.
+    void accumulate_proof(const plonk::proof& proof, bonk::PairingAccumulator& accumulator);
+
+    bonk::PairingClaim compute_pairing_claim(const plonk::proof& proof);
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
@@ -39,7 +39,8 @@ class ProverPermutationWidget : public ProverRandomWidget {
                                    work_queue& queue) override;
 
     barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                   const transcript::StandardTranscript& transcript) override;
+                                                   const transcript::StandardTranscript& transcript,
+                                                   const quotient_block& block) override;
 };
 
 } // namespace plonk
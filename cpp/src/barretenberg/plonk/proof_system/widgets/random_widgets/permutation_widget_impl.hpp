@@ -4,6 +4,7 @@
 #include "barretenberg/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/proof_system/public_inputs/public_inputs.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -89,68 +90,58 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
             lagrange_base_ids[i] = key->polynomial_store.get("id_" + std::to_string(i + 1) + "_lagrange");
     }
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-        // When we write w_i it means the evaluation of witness polynomial at i-th index.
-        // When we write w^{i} it means the generator of the subgroup to the i-th power.
-        //
-        // step 1: compute the individual terms in the permutation poylnomial.
-        //
-        // Consider the case in which we use identity permutation polynomials and let program width = 3.
-        // (extending it to the case when the permutation polynomials is not identity is trivial).
-        //
-        // coefficient of L_1: 1
-        //
-        // coefficient of L_2:
-        //
-        //  coeff_of_L1 *   (w_1 + γ + β.ω^{0}) . (w_{n+1} + γ + β.k_1.ω^{0}) . (w_{2n+1} + γ + β.k_2.ω^{0})
-        //                  ---------------------------------------------------------------------------------
-        //                  (w_1 + γ + β.σ(1) ) . (w_{n+1} + γ + β.σ(n+1)   ) . (w_{2n+1} + γ + β.σ(2n+1)  )
-        //
-        // coefficient of L_3:
-        //
-        //  coeff_of_L2 *   (w_2 + γ + β.ω^{1}) . (w_{n+2} + γ + β.k_1.ω^{1}) . (w_{2n+2} + γ + β.k_2.ω^{1})
-        //                  --------------------------------------------------------------------------------
-        //                  (w_2 + γ + β.σ(2) ) . (w_{n+2} + γ + β.σ(n+2)   ) . (w_{2n+2} + γ + β.σ(2n+2)  )
-        // and so on...
-        //
-        // accumulator data structure:
-        // numerators are stored in accumulator[0: program_width-1],
-        // denominators are stored in accumulator[program_width:]
-        //
-        //      0                                1                                      (n-1)
-        // 0 -> (w_1      + γ + β.ω^{0}    ),    (w_2      + γ + β.ω^{1}    ),    ...., (w_n      + γ + β.ω^{n-1}    )
-        // 1 -> (w_{n+1}  + γ + β.k_1.ω^{0}),    (w_{n+1}  + γ + β.k_1.ω^{2}),    ...., (w_{n+1}  + γ + β.k_1.ω^{n-1})
-        // 2 -> (w_{2n+1} + γ + β.k_2.ω^{0}),    (w_{2n+1} + γ + β.k_2.ω^{0}),    ...., (w_{2n+1} + γ + β.k_2.ω^{n-1})
-        //
-        // 3 -> (w_1      + γ + β.σ(1)     ),    (w_2      + γ + β.σ(2)     ),    ...., (w_n      + γ + β.σ(n)       )
-        // 4 -> (w_{n+1}  + γ + β.σ(n+1)   ),    (w_{n+1}  + γ + β.σ{n+2}   ),    ...., (w_{n+1}  + γ + β.σ{n+n}     )
-        // 5 -> (w_{2n+1} + γ + β.σ(2n+1)  ),    (w_{2n+1} + γ + β.σ(2n+2)  ),    ...., (w_{2n+1} + γ + β.σ(2n+n)    )
-        //
-        // Thus, to obtain coefficient_of_L2, we need to use accumulators[:][0]:
-        //    acc[0][0]*acc[1][0]*acc[2][0] / acc[program_width][0]*acc[program_width+1][0]*acc[program_width+2][0]
-        //
-        // To obtain coefficient_of_L3, we need to use accumulator[:][0] and accumulator[:][1]
-        // and so on upto coefficient_of_Ln.
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        // Recall: In a domain: num_threads * thread_size = size (= subgroup_size)
-        //        |  0 |  1 |  2 |  3 |  4 |  5 |  6 |  7 |  8 |  9 | 10 | 11 | 12 | 13 | 14 | 15 | <-- n = 16
-        //    j:  |    0    |    1    |    2    |    3    |    4    |    5    |    6    |    7    | num_threads = 8
-        //    i:     0    1    0    1    0    1    0    1    0    1    0    1    0    1    0    1   thread_size = 2
-        // So i will access a different element from 0..(n-1) each time.
-        // Commented maths notation mirrors the indexing from the giant comment immediately above.
-        for (size_t j = 0; j < key->small_domain.num_threads; ++j) {
-            barretenberg::fr thread_root = key->small_domain.root.pow(
-                static_cast<uint64_t>(j * key->small_domain.thread_size)); // effectively ω^{i} in inner loop
+    // When we write w_i it means the evaluation of witness polynomial at i-th index.
+    // When we write w^{i} it means the generator of the subgroup to the i-th power.
+    //
+    // step 1: compute the individual terms in the permutation poylnomial.
+    //
+    // Consider the case in which we use identity permutation polynomials and let program width = 3.
+    // (extending it to the case when the permutation polynomials is not identity is trivial).
+    //
+    // coefficient of L_1: 1
+    //
+    // coefficient of L_2:
+    //
+    //  coeff_of_L1 *   (w_1 + γ + β.ω^{0}) . (w_{n+1} + γ + β.k_1.ω^{0}) . (w_{2n+1} + γ + β.k_2.ω^{0})
+    //                  ---------------------------------------------------------------------------------
+    //                  (w_1 + γ + β.σ(1) ) . (w_{n+1} + γ + β.σ(n+1)   ) . (w_{2n+1} + γ + β.σ(2n+1)  )
+    //
+    // coefficient of L_3:
+    //
+    //  coeff_of_L2 *   (w_2 + γ + β.ω^{1}) . (w_{n+2} + γ + β.k_1.ω^{1}) . (w_{2n+2} + γ + β.k_2.ω^{1})
+    //                  --------------------------------------------------------------------------------
+    //                  (w_2 + γ + β.σ(2) ) . (w_{n+2} + γ + β.σ(n+2)   ) . (w_{2n+2} + γ + β.σ(2n+2)  )
+    // and so on...
+    //
+    // accumulator data structure:
+    // numerators are stored in accumulator[0: program_width-1],
+    // denominators are stored in accumulator[program_width:]
+    //
+    //      0                                1                                      (n-1)
+    // 0 -> (w_1      + γ + β.ω^{0}    ),    (w_2      + γ + β.ω^{1}    ),    ...., (w_n      + γ + β.ω^{n-1}    )
+    // 1 -> (w_{n+1}  + γ + β.k_1.ω^{0}),    (w_{n+1}  + γ + β.k_1.ω^{2}),    ...., (w_{n+1}  + γ + β.k_1.ω^{n-1})
+    // 2 -> (w_{2n+1} + γ + β.k_2.ω^{0}),    (w_{2n+1} + γ + β.k_2.ω^{0}),    ...., (w_{2n+1} + γ + β.k_2.ω^{n-1})
+    //
+    // 3 -> (w_1      + γ + β.σ(1)     ),    (w_2      + γ + β.σ(2)     ),    ...., (w_n      + γ + β.σ(n)       )
+    // 4 -> (w_{n+1}  + γ + β.σ(n+1)   ),    (w_{n+1}  + γ + β.σ{n+2}   ),    ...., (w_{n+1}  + γ + β.σ{n+n}     )
+    // 5 -> (w_{2n+1} + γ + β.σ(2n+1)  ),    (w_{2n+1} + γ + β.σ(2n+2)  ),    ...., (w_{2n+1} + γ + β.σ(2n+n)    )
+    //
+    // Thus, to obtain coefficient_of_L2, we need to use accumulators[:][0]:
+    //    acc[0][0]*acc[1][0]*acc[2][0] / acc[program_width][0]*acc[program_width+1][0]*acc[program_width+2][0]
+    //
+    // To obtain coefficient_of_L3, we need to use accumulator[:][0] and accumulator[:][1]
+    // and so on upto coefficient_of_Ln.
+    //
+    // Every range of rows starts from its own power of ω.
+    // Commented maths notation mirrors the indexing from the giant comment immediately above.
+    barretenberg::parallel_for(
+        key->small_domain.size,
+        [&](const size_t start, const size_t end) {
+            barretenberg::fr thread_root =
+                key->small_domain.root.pow(static_cast<uint64_t>(start)); // effectively ω^{i} in inner loop
             [[maybe_unused]] barretenberg::fr cur_root_times_beta = thread_root * beta; // β.ω^{i}
             barretenberg::fr T0;
             barretenberg::fr wire_plus_gamma;
-            size_t start = j * key->small_domain.thread_size;
-            size_t end = (j + 1) * key->small_domain.thread_size;
             for (size_t i = start; i < end; ++i) {
                 wire_plus_gamma = gamma + lagrange_base_wires[0][i]; // w_{i + 1} + γ
                                                                      // i in 0..(n-1)
@@ -176,67 +167,66 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
                     }
                     accumulators[k][i] = T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.id(k.n + i + 1)
 
-                    T0 = lagrange_base_sigmas[k][i] * beta;                    // β.σ(k.n + i + 1)
-                    accumulators[k + program_width][i] = T0 + wire_plus_gamma; // w_{k.n + i + 1} + γ + β.σ(k.n + i + 1)
+                    T0 = lagrange_base_sigmas[k][i] * beta; // β.σ(k.n + i + 1)
+                    // w_{k.n + i + 1} + γ + β.σ(k.n + i + 1)
+                    accumulators[k + program_width][i] = T0 + wire_plus_gamma;
                 }
                 if constexpr (!idpolys)
                     cur_root_times_beta *= key->small_domain.root; // β.ω^{i + 1}
             }
-        }
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
 
-        // Step 2: compute the constituent components of z(X). This is a small multithreading bottleneck, as we have
-        // program_width * 2 non-parallelizable processes
-        //
-        // Update the accumulator matrix a[:][:] to contain the left products like so:
-        //      0           1                     2                          (n-1)
-        // 0 -> (a[0][0]),  (a[0][1] * a[0][0]),  (a[0][2] * a[0][1]), ...,  (a[0][n-1] * a[0][n-2])
-        // 1 -> (a[1][0]),  (a[1][1] * a[1][0]),  (a[1][2] * a[1][1]), ...,  (a[1][n-1] * a[1][n-2])
-        // 2 -> (a[2][0]),  (a[2][1] * a[2][0]),  (a[2][2] * a[2][1]), ...,  (a[2][n-1] * a[2][n-2])
-        //
-        // 3 -> (a[3][0]),  (a[3][1] * a[3][0]),  (a[3][2] * a[3][1]), ...,  (a[3][n-1] * a[3][n-2])
-        // 4 -> (a[4][0]),  (a[4][1] * a[4][0]),  (a[4][2] * a[4][1]), ...,  (a[4][n-1] * a[4][n-2])
-        // 5 -> (a[5][0]),  (a[5][1] * a[5][0]),  (a[5][2] * a[5][1]), ...,  (a[5][n-1] * a[5][n-2])
-        //
-        // and so on...
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t i = 0; i < program_width * 2; ++i) {
+    // Step 2: compute the constituent components of z(X). This is a small multithreading bottleneck, as we have
+    // program_width * 2 non-parallelizable processes
+    //
+    // Update the accumulator matrix a[:][:] to contain the left products like so:
+    //      0           1                     2                          (n-1)
+    // 0 -> (a[0][0]),  (a[0][1] * a[0][0]),  (a[0][2] * a[0][1]), ...,  (a[0][n-1] * a[0][n-2])
+    // 1 -> (a[1][0]),  (a[1][1] * a[1][0]),  (a[1][2] * a[1][1]), ...,  (a[1][n-1] * a[1][n-2])
+    // 2 -> (a[2][0]),  (a[2][1] * a[2][0]),  (a[2][2] * a[2][1]), ...,  (a[2][n-1] * a[2][n-2])
+    //
+    // 3 -> (a[3][0]),  (a[3][1] * a[3][0]),  (a[3][2] * a[3][1]), ...,  (a[3][n-1] * a[3][n-2])
+    // 4 -> (a[4][0]),  (a[4][1] * a[4][0]),  (a[4][2] * a[4][1]), ...,  (a[4][n-1] * a[4][n-2])
+    // 5 -> (a[5][0]),  (a[5][1] * a[5][0]),  (a[5][2] * a[5][1]), ...,  (a[5][n-1] * a[5][n-2])
+    //
+    // and so on...
+    barretenberg::parallel_for(program_width * 2, [&](const size_t rows_start, const size_t rows_end) {
+        for (size_t i = rows_start; i < rows_end; ++i) {
             fr* coeffs = &accumulators[i][0]; // start from the beginning of a row
             for (size_t j = 0; j < key->small_domain.size - 1; ++j) {
                 coeffs[j + 1] *= coeffs[j]; // iteratively update elements in subsequent columns
             }
         }
+    });
 
-        // step 3: concatenate together the accumulator elements into z(X)
-        //
-        // Update each element of the accumulator row a[0] to be the product of itself with the 'numerator' rows beneath
-        // it, and update each element of a[program_width] to be the product of itself with the 'denominator' rows
-        // beneath it.
-        //
-        //       0                                     1                                           (n-1)
-        // 0 ->  (a[0][0] * a[1][0] * a[2][0]),        (a[0][1] * a[1][1] * a[2][1]),        ...., (a[0][n-1] *
-        // a[1][n-1] * a[2][n-1])
-        //
-        // pw -> (a[pw][0] * a[pw+1][0] * a[pw+2][0]), (a[pw][1] * a[pw+1][1] * a[pw+2][1]), ...., (a[pw][n-1] *
-        // a[pw+1][n-1] * a[pw+2][n-1])
-        //
-        // Note that pw = program_width
-        //
-        // Hereafter, we can compute
-        // coefficient_Lj = a[0][j]/a[pw][j]
-        //
-        // Naive way of computing these coefficients would result in n inversions, which is pretty expensive.
-        // Instead we use Montgomery's trick for batch inversion.
-        // Montgomery's trick documentation:
-        // ./src/barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp/L286
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t j = 0; j < key->small_domain.num_threads; ++j) {
-            const size_t start = j * key->small_domain.thread_size;
-            const size_t end =
-                ((j + 1) * key->small_domain.thread_size) - ((j == key->small_domain.num_threads - 1) ? 1 : 0);
+    // step 3: concatenate together the accumulator elements into z(X)
+    //
+    // Update each element of the accumulator row a[0] to be the product of itself with the 'numerator' rows beneath
+    // it, and update each element of a[program_width] to be the product of itself with the 'denominator' rows
+    // beneath it.
+    //
+    //       0                                     1                                           (n-1)
+    // 0 ->  (a[0][0] * a[1][0] * a[2][0]),        (a[0][1] * a[1][1] * a[2][1]),        ...., (a[0][n-1] *
+    // a[1][n-1] * a[2][n-1])
+    //
+    // pw -> (a[pw][0] * a[pw+1][0] * a[pw+2][0]), (a[pw][1] * a[pw+1][1] * a[pw+2][1]), ...., (a[pw][n-1] *
+    // a[pw+1][n-1] * a[pw+2][n-1])
+    //
+    // Note that pw = program_width
+    //
+    // Hereafter, we can compute
+    // coefficient_Lj = a[0][j]/a[pw][j]
+    //
+    // Naive way of computing these coefficients would result in n inversions, which is pretty expensive.
+    // Instead we use Montgomery's trick for batch inversion.
+    // Montgomery's trick documentation:
+    // ./src/barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp/L286
+    // One batch inversion per range of rows. The last row is not needed: z(X) has only n - 1 of these coefficients
+    barretenberg::parallel_for(
+        key->small_domain.size,
+        [&](const size_t start, const size_t range_end) {
+            const size_t end = std::min(range_end, key->small_domain.size - 1);
             barretenberg::fr inversion_accumulator = fr::one();
             constexpr size_t inversion_index = (program_width == 1) ? 2 : program_width * 2 - 1;
             fr* inversion_coefficients = &accumulators[inversion_index][0];
@@ -257,8 +247,8 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
                 accumulators[0][i] = inversion_accumulator * inversion_coefficients[i];
                 inversion_accumulator *= accumulators[program_width][i];
             }
-        }
-    }
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
 
     // Construct permutation polynomial 'z' in lagrange form as:
     // z = [1 accumulators[0][0] accumulators[0][1] ... accumulators[0][n-2]]
@@ -344,7 +334,9 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
 
 template <size_t program_width, bool idpolys, const size_t num_roots_cut_out_of_vanishing_polynomial>
 barretenberg::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanishing_polynomial>::
-    compute_quotient_contribution(const fr& alpha_base, const transcript::StandardTranscript& transcript)
+    compute_quotient_contribution(const fr& alpha_base,
+                                  const transcript::StandardTranscript& transcript,
+                                  const quotient_block& block)
 {
     const polynomial& z_perm_fft = key->polynomial_store.get("z_perm_fft");
 
@@ -402,134 +394,136 @@ barretenberg::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_o
     barretenberg::fr public_input_delta =
         compute_public_input_delta<fr>(public_inputs, beta, gamma, key->small_domain.root);
 
-    const size_t block_mask = key->large_domain.size - 1;
+    const size_t block_mask = block.domain.size - 1;
+    const size_t index_shift = block.index_shift;
     // Step 4: Set the quotient polynomial to be equal to
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < key->large_domain.num_threads; ++j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
-
-        // Leverage multi-threading by computing quotient polynomial at points
-        // (ω^{j * num_threads}, ω^{j * num_threads + 1}, ..., ω^{j * num_threads + num_threads})
-        //
-        // curr_root = ω^{j * num_threads} * g_{small} * β
-        // curr_root will be used in denominator
-        barretenberg::fr cur_root_times_beta =
-            key->large_domain.root.pow(static_cast<uint64_t>(j * key->large_domain.thread_size));
-        cur_root_times_beta *= key->small_domain.generator;
-        cur_root_times_beta *= beta;
-
-        barretenberg::fr wire_plus_gamma;
-        barretenberg::fr T0;
-        barretenberg::fr denominator;
-        barretenberg::fr numerator;
-        for (size_t i = start; i < end; ++i) {
-            wire_plus_gamma = gamma + wire_ffts[0][i];
-
-            // Numerator computation
-            if constexpr (!idpolys)
-                // identity polynomial used as a monomial: S_{id1} = x, S_{id2} = k_1.x, S_{id3} = k_2.x
-                // start with (w_l(X) + β.X + γ)
-                numerator = cur_root_times_beta + wire_plus_gamma;
-            else
-                numerator = id_ffts[0][i] * beta + wire_plus_gamma;
-
-            // Denominator computation
-            // start with (w_l(X) + β.σ_1(X) + γ)
-            denominator = sigma_ffts[0][i] * beta;
-            denominator += wire_plus_gamma;
-
-            for (size_t k = 1; k < program_width; ++k) {
-                wire_plus_gamma = gamma + wire_ffts[k][i];
+    barretenberg::parallel_for(
+        block.domain.size,
+        [&](const size_t start, const size_t end) {
+            // Leverage multi-threading by computing quotient polynomial at points
+            // (ω^{start}, ω^{start + 1}, ..., ω^{end - 1}) of the block's coset, ω the root of unity of the block's
+            // domain
+            //
+            // curr_root = ω^{start} * g_{small} * (block generator shift) * β
+            // curr_root will be used in denominator
+            barretenberg::fr cur_root_times_beta = block.domain.root.pow(static_cast<uint64_t>(start));
+            cur_root_times_beta *= block.generator_shift;
+            cur_root_times_beta *= key->small_domain.generator;
+            cur_root_times_beta *= beta;
+
+            barretenberg::fr wire_plus_gamma;
+            barretenberg::fr T0;
+            barretenberg::fr denominator;
+            barretenberg::fr numerator;
+            for (size_t i = start; i < end; ++i) {
+                wire_plus_gamma = gamma + wire_ffts[0][i];
+
+                // Numerator computation
                 if constexpr (!idpolys)
-                    // (w_r(X) + β.(k_{k}.X) + γ)
-                    T0 = fr::coset_generator(k - 1) * cur_root_times_beta;
-                if constexpr (idpolys)
-                    T0 = id_ffts[k][i] * beta;
-
-                T0 += wire_plus_gamma;
-                numerator *= T0;
-
-                // (w_r(X) + β.σ_{k}(X) + γ)
-                T0 = sigma_ffts[k][i] * beta;
-                T0 += wire_plus_gamma;
-                denominator *= T0;
-            }
+                    // identity polynomial used as a monomial: S_{id1} = x, S_{id2} = k_1.x, S_{id3} = k_2.x
+                    // start with (w_l(X) + β.X + γ)
+                    numerator = cur_root_times_beta + wire_plus_gamma;
+                else
+                    numerator = id_ffts[0][i] * beta + wire_plus_gamma;
 
-            numerator *= z_perm_fft[i];
-            denominator *= z_perm_fft[(i + 4) & block_mask];
-
-            /**
-             * Permutation bounds check
-             * (z(X.w) - 1).(α^3).L_{end}(X) = T(X).Z*_H(X)
-             *
-             * where Z*_H(X) = (X^n - 1)/[(X - ω^{n-1})...(X - ω^{n - num_roots_cut_out_of_vanishing_polynomial})]
-             * i.e. we remove some roots from the true vanishing polynomial to ensure that the overall degree
-             * of the permutation polynomial is <= n.
-             * Read more on this here: https://hackmd.io/1DaroFVfQwySwZPHMoMdBg
-             *
-             * Therefore, L_{end} = L_{n - num_roots_cut_out_of_vanishing_polynomial}
-             **/
-            // The α^3 term is so that we can subsume this polynomial into the quotient polynomial,
-            // whilst ensuring the term is linearly independent form the other terms in the quotient polynomial
-
-            // We want to verify that z(X) equals `1` when evaluated at `ω_n`, the 'last' element of our multiplicative
-            // subgroup H. But PLONK's 'vanishing polynomial', Z*_H(X), isn't the true vanishing polynomial of subgroup
-            // H. We need to cut a root of unity out of Z*_H(X), specifically `ω_n`, for our grand product argument.
-            // When evaluating z(X) has been constructed correctly, we verify that z(X.ω).(identity permutation product)
-            // = z(X).(sigma permutation product), for all X \in H. But this relationship breaks down for X = ω_n,
-            // because z(X.ω) will evaluate to the *first* element of our grand product argument. The last element of
-            // z(X) has a dependency on the first element, so the first element cannot have a dependency on the last
-            // element.
-
-            // TODO: With the reduction from 2 z polynomials to a single z(X), the above no longer applies
-            // TODO: Fix this to remove the (z(X.ω) - 1).L_{n-1}(X) check
-
-            // To summarise, we can't verify claims about z(X) when evaluated at `ω_n`.
-            // But we can verify claims about z(X.ω) when evaluated at `ω_{n-1}`, which is the same thing
-
-            // To summarise the summary: If z(ω_n) = 1, then (z(X.ω) - 1).L_{n-1}(X) will be divisible by Z_H*(X)
-            // => add linearly independent term (z(X.ω) - 1).(α^3).L{n-1}(X) into the quotient polynomial to check
-            // this
-
-            // z_perm_fft already contains evaluations of Z(X).(\alpha^2)
-            // at the (4n)'th roots of unity
-            // => to get Z(X.w) instead of Z(X), index element (i+4) instead of i
-            T0 = z_perm_fft[(i + 4) & block_mask] - public_input_delta; // T0 = (Z(X.w) - (delta)).(\alpha^2)
-            T0 *= alpha_base;                                           // T0 = (Z(X.w) - (delta)).(\alpha^3)
-
-            // T0 = (z(X.ω) - Δ).(α^3).L_{end}
-            // where L_{end} = L{n - num_roots_cut_out_of_vanishing_polynomial}.
-            //
-            // Note that L_j(X) = L_1(X . ω^{-j}) = L_1(X . ω^{n-j})
-            // => L_{end}= L_1(X . ω^{num_roots_cut_out_of_vanishing_polynomial + 1})
-            // => fetch the value at index (i + (num_roots_cut_out_of_vanishing_polynomial + 1) * 4) in l_1
-            // the factor of 4 is because l_1 is a 4n-size fft.
-            //
-            // Recall, we use l_start for l_1 for consistency in notation.
-            T0 *= l_start[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
-            numerator += T0;
-
-            // Step 2: Compute (z(X) - 1).(α^4).L1(X)
-            // We need to verify that z(X) equals `1` when evaluated at the first element of our subgroup H
-            // i.e. z(X) starts at 1 and ends at 1
-            // The `alpha^4` term is so that we can add this as a linearly independent term in our quotient polynomial
-            T0 = z_perm_fft[i] - fr(1); // T0 = (Z(X) - 1).(\alpha^2)
-            T0 *= alpha_squared;        // T0 = (Z(X) - 1).(\alpha^4)
-            T0 *= l_start[i];           // T0 = (Z(X) - 1).(\alpha^2).L1(X)
-            numerator += T0;
-
-            // Combine into quotient polynomial
-            T0 = numerator - denominator;
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] =
-                T0 * alpha_base;
-
-            // Update our working root of unity
-            cur_root_times_beta *= key->large_domain.root;
-        }
-    }
+                // Denominator computation
+                // start with (w_l(X) + β.σ_1(X) + γ)
+                denominator = sigma_ffts[0][i] * beta;
+                denominator += wire_plus_gamma;
+
+                for (size_t k = 1; k < program_width; ++k) {
+                    wire_plus_gamma = gamma + wire_ffts[k][i];
+                    if constexpr (!idpolys)
+                        // (w_r(X) + β.(k_{k}.X) + γ)
+                        T0 = fr::coset_generator(k - 1) * cur_root_times_beta;
+                    if constexpr (idpolys)
+                        T0 = id_ffts[k][i] * beta;
+
+                    T0 += wire_plus_gamma;
+                    numerator *= T0;
+
+                    // (w_r(X) + β.σ_{k}(X) + γ)
+                    T0 = sigma_ffts[k][i] * beta;
+                    T0 += wire_plus_gamma;
+                    denominator *= T0;
+                }
+
+                numerator *= z_perm_fft[i];
+                denominator *= z_perm_fft[(i + index_shift) & block_mask];
+
+                /**
+                 * Permutation bounds check
+                 * (z(X.w) - 1).(α^3).L_{end}(X) = T(X).Z*_H(X)
+                 *
+                 * where Z*_H(X) = (X^n - 1)/[(X - ω^{n-1})...(X - ω^{n - num_roots_cut_out_of_vanishing_polynomial})]
+                 * i.e. we remove some roots from the true vanishing polynomial to ensure that the overall degree
+                 * of the permutation polynomial is <= n.
+                 * Read more on this here: https://hackmd.io/1DaroFVfQwySwZPHMoMdBg
+                 *
+                 * Therefore, L_{end} = L_{n - num_roots_cut_out_of_vanishing_polynomial}
+                 **/
+                // The α^3 term is so that we can subsume this polynomial into the quotient polynomial,
+                // whilst ensuring the term is linearly independent form the other terms in the quotient polynomial
+
+                // We want to verify that z(X) equals `1` when evaluated at `ω_n`, the 'last' element of our
+                // multiplicative subgroup H. But PLONK's 'vanishing polynomial', Z*_H(X), isn't the true vanishing
+                // polynomial of subgroup H. We need to cut a root of unity out of Z*_H(X), specifically `ω_n`, for our
+                // grand product argument. When evaluating z(X) has been constructed correctly, we verify that
+                // z(X.ω).(identity permutation product) = z(X).(sigma permutation product), for all X \in H. But this
+                // relationship breaks down for X = ω_n, because z(X.ω) will evaluate to the *first* element of our
+                // grand product argument. The last element of z(X) has a dependency on the first element, so the first
+                // element cannot have a dependency on the last element.
+
+                // TODO: With the reduction from 2 z polynomials to a single z(X), the above no longer applies
+                // TODO: Fix this to remove the (z(X.ω) - 1).L_{n-1}(X) check
+
+                // To summarise, we can't verify claims about z(X) when evaluated at `ω_n`.
+                // But we can verify claims about z(X.ω) when evaluated at `ω_{n-1}`, which is the same thing
+
+                // To summarise the summary: If z(ω_n) = 1, then (z(X.ω) - 1).L_{n-1}(X) will be divisible by Z_H*(X)
+                // => add linearly independent term (z(X.ω) - 1).(α^3).L{n-1}(X) into the quotient polynomial to check
+                // this
+
+                // z_perm_fft already contains evaluations of Z(X).(\alpha^2)
+                // at the (4n)'th roots of unity
+                // => to get Z(X.w) instead of Z(X), index element (i+4) instead of i (i+index_shift within a block)
+                // T0 = (Z(X.w) - (delta)).(\alpha^2)
+                T0 = z_perm_fft[(i + index_shift) & block_mask] - public_input_delta;
+                T0 *= alpha_base; // T0 = (Z(X.w) - (delta)).(\alpha^3)
+
+                // T0 = (z(X.ω) - Δ).(α^3).L_{end}
+                // where L_{end} = L{n - num_roots_cut_out_of_vanishing_polynomial}.
+                //
+                // Note that L_j(X) = L_1(X . ω^{-j}) = L_1(X . ω^{n-j})
+                // => L_{end}= L_1(X . ω^{num_roots_cut_out_of_vanishing_polynomial + 1})
+                // => fetch the value at index (i + (num_roots_cut_out_of_vanishing_polynomial + 1) * 4) in l_1
+                // the factor of 4 is because l_1 is a 4n-size fft (within a block of the 4n coset, it is index_shift).
+                //
+                // Recall, we use l_start for l_1 for consistency in notation.
+                T0 *= l_start[(i + index_shift + index_shift * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
+                numerator += T0;
+
+                // Step 2: Compute (z(X) - 1).(α^4).L1(X)
+                // We need to verify that z(X) equals `1` when evaluated at the first element of our subgroup H
+                // i.e. z(X) starts at 1 and ends at 1
+                // The `alpha^4` term is so that we can add this as a linearly independent term in our quotient
+                // polynomial
+                T0 = z_perm_fft[i] - fr(1); // T0 = (Z(X) - 1).(\alpha^2)
+                T0 *= alpha_squared;        // T0 = (Z(X) - 1).(\alpha^4)
+                T0 *= l_start[i];           // T0 = (Z(X) - 1).(\alpha^2).L1(X)
+                numerator += T0;
+
+                // Combine into quotient polynomial
+                T0 = numerator - denominator;
+                const size_t quotient_index = block.get_large_domain_index(i);
+                key->quotient_polynomial_parts[quotient_index >> key->small_domain.log2_size]
+                                              [quotient_index & (key->circuit_size - 1)] = T0 * alpha_base;
+
+                // Update our working root of unity
+                cur_root_times_beta *= block.domain.root;
+            }
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
     return alpha_base.sqr().sqr();
 }
 
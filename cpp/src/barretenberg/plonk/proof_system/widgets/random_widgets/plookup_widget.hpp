@@ -43,7 +43,8 @@ class ProverPlookupWidget : public ProverRandomWidget {
                                           work_queue& queue) override;
 
     inline barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                          const transcript::StandardTranscript& transcript) override;
+                                                          const transcript::StandardTranscript& transcript,
+                                                          const quotient_block& block) override;
 };
 
 } // namespace plonk
@@ -2,6 +2,7 @@
 
 #include "barretenberg/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -169,40 +170,32 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_gra
     const fr beta_constant = beta + fr(1);                // (1 + β)
     const fr gamma_beta_constant = gamma * beta_constant; // γ(1 + β)
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        // Step 1: Compute polynomials f, t and s and incorporate them into terms that are ultimately needed
-        // to construct the grand product polynomial Z_lookup(X):
-        // Note 1: In what follows, 't' is associated with table values (and is not to be confused with the
-        // quotient polynomial, also refered to as 't' elsewhere). Polynomial 's' is the sorted  concatenation
-        // of the witnesses and the table values.
-        // Note 2: Evaluation at Xω is indicated explicitly, e.g. 'p(Xω)'; evaluation at X is simply omitted, e.g. 'p'
-        //
-        // 1a.   Compute f, then set accumulators[0] = (q_lookup*f + γ), where
-        //
-        //         f = (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index.
-        //      Note that q_2, q_m, and q_c are just the selectors from Standard Plonk that have been repurposed
-        //      in the context of the plookup gate to represent 'shift' values. For example, setting each of the
-        //      q_* in f to 2^8 facilitates operations on 32-bit values via four operations on 8-bit values. See
-        //      Ultra documentation for details.
-        //
-        // 1b.   Compute t, then set accumulators[1] = (t + βt(Xω) + γ(1 + β)), where t = t_1 + ηt_2 + η²t_3 + η³t_4
-        //
-        // 1c.   Set accumulators[2] = (1 + β)
-        //
-        // 1d.   Compute s, then set accumulators[3] = (s + βs(Xω) + γ(1 + β)), where s = s_1 + ηs_2 + η²s_3 + η³s_4
-        //
-        for (size_t j = 0; j < key->small_domain.num_threads; ++j) {
+    // Step 1: Compute polynomials f, t and s and incorporate them into terms that are ultimately needed
+    // to construct the grand product polynomial Z_lookup(X):
+    // Note 1: In what follows, 't' is associated with table values (and is not to be confused with the
+    // quotient polynomial, also refered to as 't' elsewhere). Polynomial 's' is the sorted  concatenation
+    // of the witnesses and the table values.
+    // Note 2: Evaluation at Xω is indicated explicitly, e.g. 'p(Xω)'; evaluation at X is simply omitted, e.g. 'p'
+    //
+    // 1a.   Compute f, then set accumulators[0] = (q_lookup*f + γ), where
+    //
+    //         f = (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index.
+    //      Note that q_2, q_m, and q_c are just the selectors from Standard Plonk that have been repurposed
+    //      in the context of the plookup gate to represent 'shift' values. For example, setting each of the
+    //      q_* in f to 2^8 facilitates operations on 32-bit values via four operations on 8-bit values. See
+    //      Ultra documentation for details.
+    //
+    // 1b.   Compute t, then set accumulators[1] = (t + βt(Xω) + γ(1 + β)), where t = t_1 + ηt_2 + η²t_3 + η³t_4
+    //
+    // 1c.   Set accumulators[2] = (1 + β)
+    //
+    // 1d.   Compute s, then set accumulators[3] = (s + βs(Xω) + γ(1 + β)), where s = s_1 + ηs_2 + η²s_3 + η³s_4
+    //
+    barretenberg::parallel_for(
+        key->small_domain.size,
+        [&](const size_t start, const size_t end) {
             fr T0;
 
-            size_t start = j * key->small_domain.thread_size;
-            size_t end = (j + 1) * key->small_domain.thread_size;
-
             // Note: block_mask is used for efficient modulus, i.e. i % N := i & (N-1), for N = 2^k
             const size_t block_mask = key->small_domain.size - 1;
 
@@ -250,54 +243,51 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_gra
                 accumulators[3][i] += s_lagrange[i];
                 accumulators[3][i] += gamma_beta_constant;
             }
-        }
-
-// Step 2: Compute the constituent product components of Z_lookup(X).
-// Let ∏ := Prod_{k<j}. Let f_k, t_k and s_k now represent the k'th component of the polynomials f,t and s
-// defined above. We compute the following four product polynomials needed to construct the grand product
-// Z_lookup(X).
-// 1.   accumulators[0][j] = ∏ (q_lookup*f_k + γ)
-// 2.   accumulators[1][j] = ∏ (t_k + βt_{k+1} + γ(1 + β))
-// 3.   accumulators[2][j] = ∏ (1 + β)
-// 4.   accumulators[3][j] = ∏ (s_k + βs_{k+1} + γ(1 + β))
-// Note: This is a small multithreading bottleneck, as we have only 4 parallelizable processes.
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t i = 0; i < 4; ++i) {
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
+
+    // Step 2: Compute the constituent product components of Z_lookup(X).
+    // Let ∏ := Prod_{k<j}. Let f_k, t_k and s_k now represent the k'th component of the polynomials f,t and s
+    // defined above. We compute the following four product polynomials needed to construct the grand product
+    // Z_lookup(X).
+    // 1.   accumulators[0][j] = ∏ (q_lookup*f_k + γ)
+    // 2.   accumulators[1][j] = ∏ (t_k + βt_{k+1} + γ(1 + β))
+    // 3.   accumulators[2][j] = ∏ (1 + β)
+    // 4.   accumulators[3][j] = ∏ (s_k + βs_{k+1} + γ(1 + β))
+    // Note: This is a small multithreading bottleneck, as we have only 4 parallelizable processes.
+    barretenberg::parallel_for(4, [&](const size_t accumulators_start, const size_t accumulators_end) {
+        for (size_t i = accumulators_start; i < accumulators_end; ++i) {
             fr* coeffs = &accumulators[i][0];
             for (size_t j = 0; j < key->small_domain.size - 1; ++j) {
                 coeffs[j + 1] *= coeffs[j];
             }
         }
-
-// Step 3: Combine the accumulator product elements to construct Z_lookup(X).
-//
-//                      ∏ (1 + β) ⋅ ∏ (q_lookup*f_k + γ) ⋅ ∏ (t_k + βt_{k+1} + γ(1 + β))
-//  Z_lookup(g^j) = --------------------------------------------------------------------------
-//                                      ∏ (s_k + βs_{k+1} + γ(1 + β))
-//
-// Note: Montgomery batch inversion is used to efficiently compute the coefficients of Z_lookup
-// rather than peforming n individual inversions. I.e. we first compute the double product P_n:
-//
-// P_n := ∏_{j<n} ∏_{k<j} S_k, where S_k = (s_k + βs_{k+1} + γ(1 + β))
-//
-// and then compute the inverse on P_n. Then we work back to front to obtain terms of the form
-// 1/∏_{k<i} S_i that appear in Z_lookup, using the fact that P_i/P_{i+1} = 1/∏_{k<i} S_i. (Note
-// that once we have 1/P_n, we can compute 1/P_{n-1} as (1/P_n) * ∏_{k<n} S_i, and
-// so on).
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        // Compute Z_lookup using Montgomery batch inversion
-        // Note: This loop sets the values of z_lookup[i] for i = 1,...,(n-1), (Recall accumulators[0][i] = z_lookup[i +
-        // 1])
-        for (size_t j = 0; j < key->small_domain.num_threads; ++j) {
-            const size_t start = j * key->small_domain.thread_size;
+    });
+
+    // Step 3: Combine the accumulator product elements to construct Z_lookup(X).
+    //
+    //                      ∏ (1 + β) ⋅ ∏ (q_lookup*f_k + γ) ⋅ ∏ (t_k + βt_{k+1} + γ(1 + β))
+    //  Z_lookup(g^j) = --------------------------------------------------------------------------
+    //                                      ∏ (s_k + βs_{k+1} + γ(1 + β))
+    //
+    // Note: Montgomery batch inversion is used to efficiently compute the coefficients of Z_lookup
+    // rather than peforming n individual inversions. I.e. we first compute the double product P_n:
+    //
+    // P_n := ∏_{j<n} ∏_{k<j} S_k, where S_k = (s_k + βs_{k+1} + γ(1 + β))
+    //
+    // and then compute the inverse on P_n. Then we work back to front to obtain terms of the form
+    // 1/∏_{k<i} S_i that appear in Z_lookup, using the fact that P_i/P_{i+1} = 1/∏_{k<i} S_i. (Note
+    // that once we have 1/P_n, we can compute 1/P_{n-1} as (1/P_n) * ∏_{k<n} S_i, and
+    // so on).
+    //
+    // Compute Z_lookup using Montgomery batch inversion, once per range of rows
+    // Note: This loop sets the values of z_lookup[i] for i = 1,...,(n-1), (Recall accumulators[0][i] = z_lookup[i + 1])
+    barretenberg::parallel_for(
+        key->small_domain.size,
+        [&](const size_t start, const size_t range_end) {
             // Set 'end' so its max value is (n-1) thus max value for 'i' is n-2 (N.B. accumulators[0][n-2] =
             // z_lookup[n-1])
-            const size_t end = (j == key->small_domain.num_threads - 1) ? (j + 1) * key->small_domain.thread_size - 1
-                                                                        : (j + 1) * key->small_domain.thread_size;
+            const size_t end = std::min(range_end, key->small_domain.size - 1);
 
             // Compute <Z_lookup numerator> * ∏_{j<i}∏_{k<j}S_k
             fr inversion_accumulator = fr::one();
@@ -317,8 +307,9 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_gra
                 accumulators[0][i] *= inversion_accumulator;
                 inversion_accumulator *= accumulators[3][i];
             }
-        }
-    }
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
+
     z_lookup[0] = fr::one();
 
     // Since `z_plookup` needs to be evaluated at 2 points in UltraPLONK, we need to add a degree-2 random
@@ -423,7 +414,7 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
  */
 template <const size_t num_roots_cut_out_of_vanishing_polynomial>
 barretenberg::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_quotient_contribution(
-    const fr& alpha_base, const transcript::StandardTranscript& transcript)
+    const fr& alpha_base, const transcript::StandardTranscript& transcript, const quotient_block& block)
 {
     const polynomial& z_lookup_fft = key->polynomial_store.get("z_lookup_fft");
 
@@ -463,103 +454,105 @@ barretenberg::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>:
 
     const fr beta_constant = beta + fr(1); // (1 + β)
 
-    const size_t block_mask = key->large_domain.size - 1;
+    const size_t block_mask = block.domain.size - 1;
+    // the shift X -> Xω, which is 4 on the full 4n coset
+    const size_t index_shift = block.index_shift;
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
     // Add to the quotient polynomial the components associated with z_lookup
-    for (size_t j = 0; j < key->large_domain.num_threads; ++j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
-
-        fr T0;
-        fr T1;
-        fr denominator;
-        fr numerator;
-
-        // Initialize first four t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
-        std::array<fr, 4> next_ts;
-        for (size_t i = 0; i < 4; ++i) {
-            next_ts[i] = table_ffts[3][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[2][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[1][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[0][(start + i) & block_mask];
-        }
-        for (size_t i = start; i < end; ++i) {
-            // Set T0 = f := (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index
-            T0 = lookup_index_fft[i];
-            T0 *= eta;
-            T0 += wire_ffts[2][(i + 4) & block_mask] * column_3_step_size[i];
-            T0 += wire_ffts[2][i];
-            T0 *= eta;
-            T0 += wire_ffts[1][(i + 4) & block_mask] * column_2_step_size[i];
-            T0 += wire_ffts[1][i];
-            T0 *= eta;
-            T0 += wire_ffts[0][(i + 4) & block_mask] * column_1_step_size[i];
-            T0 += wire_ffts[0][i];
-
-            // Set numerator = q_lookup*f + γ
-            numerator = T0;
-            numerator *= lookup_fft[i];
-            numerator += gamma;
-
-            // Set T0 = t(Xω) := t_1(Xω) + ηt_2(Xω) + η²t_3(Xω) + η³t_4(Xω)
-            T0 = table_ffts[3][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[2][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[1][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[0][(i + 4) & block_mask];
-
-            // Set T1 = (t + βt(Xω) + γ(1 + β))
-            T1 = beta;
-            T1 *= T0;
-            T1 += next_ts[i & 0x03UL];
-            T1 += gamma_beta_constant;
-
-            // Set t(X) = t(Xω) for the next time around
-            next_ts[i & 0x03UL] = T0;
-
-            // numerator = (q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)
-            numerator *= T1;
-            numerator *= beta_constant;
-
-            // Set denominator = (s + βs(Xω) + γ(1 + β))
-            denominator = s_fft[(i + 4) & block_mask];
-            denominator *= beta;
-            denominator += s_fft[i];
-            denominator += gamma_beta_constant;
-
-            // Set T0 = αL_1(X)
-            T0 = l_1[i] * alpha;
-            // Set T1 = α²L_{n-k}(X) = α²L_1(Xω^{-(n-k)+1}) = α²L_1(Xω^{k+1}), k = num roots cut out of Z_H
-            T1 = l_1[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask] * alpha_sqr;
-
-            // Set numerator = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup -
-            // 1)*αL_1(X)
-            numerator += T0;
-            numerator *= z_lookup_fft[i];
-            numerator -= T0;
-
-            // Set denominator = z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) - [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
-            denominator -= T1;
-            denominator *= z_lookup_fft[(i + 4) & block_mask];
-            denominator += T1 * delta_factor;
-
-            // Combine into quotient polynomial contribution
-            // T0 = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup - 1)*αL_1(X) ...
-            //      - z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) + [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
-            T0 = numerator - denominator;
-            // key->quotient_large[i] += T0 * alpha_base; // CODY: Luke did this while documenting
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] +=
-                T0 * alpha_base;
-        }
-    }
+    barretenberg::parallel_for(
+        block.domain.size,
+        [&](const size_t start, const size_t end) {
+            fr T0;
+            fr T1;
+            fr denominator;
+            fr numerator;
+
+            // Initialize first index_shift (at most four) t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
+            std::array<fr, 4> next_ts;
+            for (size_t i = 0; i < index_shift; ++i) {
+                next_ts[i] = table_ffts[3][(start + i) & block_mask];
+                next_ts[i] *= eta;
+                next_ts[i] += table_ffts[2][(start + i) & block_mask];
+                next_ts[i] *= eta;
+                next_ts[i] += table_ffts[1][(start + i) & block_mask];
+                next_ts[i] *= eta;
+                next_ts[i] += table_ffts[0][(start + i) & block_mask];
+            }
+            for (size_t i = start; i < end; ++i) {
+                // Set T0 = f := (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index
+                T0 = lookup_index_fft[i];
+                T0 *= eta;
+                T0 += wire_ffts[2][(i + index_shift) & block_mask] * column_3_step_size[i];
+                T0 += wire_ffts[2][i];
+                T0 *= eta;
+                T0 += wire_ffts[1][(i + index_shift) & block_mask] * column_2_step_size[i];
+                T0 += wire_ffts[1][i];
+                T0 *= eta;
+                T0 += wire_ffts[0][(i + index_shift) & block_mask] * column_1_step_size[i];
+                T0 += wire_ffts[0][i];
+
+                // Set numerator = q_lookup*f + γ
+                numerator = T0;
+                numerator *= lookup_fft[i];
+                numerator += gamma;
+
+                // Set T0 = t(Xω) := t_1(Xω) + ηt_2(Xω) + η²t_3(Xω) + η³t_4(Xω)
+                T0 = table_ffts[3][(i + index_shift) & block_mask];
+                T0 *= eta;
+                T0 += table_ffts[2][(i + index_shift) & block_mask];
+                T0 *= eta;
+                T0 += table_ffts[1][(i + index_shift) & block_mask];
+                T0 *= eta;
+                T0 += table_ffts[0][(i + index_shift) & block_mask];
+
+                // Set T1 = (t + βt(Xω) + γ(1 + β))
+                T1 = beta;
+                T1 *= T0;
+                T1 += next_ts[i & (index_shift - 1)];
+                T1 += gamma_beta_constant;
+
+                // Set t(X) = t(Xω) for the next time around
+                next_ts[i & (index_shift - 1)] = T0;
+
+                // numerator = (q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)
+                numerator *= T1;
+                numerator *= beta_constant;
+
+                // Set denominator = (s + βs(Xω) + γ(1 + β))
+                denominator = s_fft[(i + index_shift) & block_mask];
+                denominator *= beta;
+                denominator += s_fft[i];
+                denominator += gamma_beta_constant;
+
+                // Set T0 = αL_1(X)
+                T0 = l_1[i] * alpha;
+                // Set T1 = α²L_{n-k}(X) = α²L_1(Xω^{-(n-k)+1}) = α²L_1(Xω^{k+1}), k = num roots cut out of Z_H
+                T1 = l_1[(i + index_shift + index_shift * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
+                T1 *= alpha_sqr;
+
+                // Set numerator = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup -
+                // 1)*αL_1(X)
+                numerator += T0;
+                numerator *= z_lookup_fft[i];
+                numerator -= T0;
+
+                // Set denominator = z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) -
+                //                   [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
+                denominator -= T1;
+                denominator *= z_lookup_fft[(i + index_shift) & block_mask];
+                denominator += T1 * delta_factor;
+
+                // Combine into quotient polynomial contribution
+                // T0 = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup - 1)*αL_1(X) ...
+                //      - z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) + [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
+                T0 = numerator - denominator;
+                // key->quotient_large[i] += T0 * alpha_base; // CODY: Luke did this while documenting
+                const size_t quotient_index = block.get_large_domain_index(i);
+                key->quotient_polynomial_parts[quotient_index >> key->small_domain.log2_size]
+                                              [quotient_index & (key->circuit_size - 1)] += T0 * alpha_base;
+            }
+        },
+        RANDOM_WIDGET_MIN_GRAIN_SIZE);
     return alpha_base * alpha.sqr() * alpha;
 }
 
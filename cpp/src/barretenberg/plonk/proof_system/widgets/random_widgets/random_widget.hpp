@@ -1,6 +1,7 @@
 #pragma once
 #include "../../../../transcript/transcript.hpp"
 #include "../../../../proof_system/work_queue/work_queue.hpp"
+#include "../../types/quotient_block.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 
 #include <map>
@@ -14,6 +15,10 @@ struct proving_key;
 
 class ReferenceString;
 
+// Smallest range of rows a random widget hands to one thread. A range starts from a power of a root of unity, and a
+// range of a grand product ends in an inversion: this keeps both small next to the range's work
+constexpr size_t RANDOM_WIDGET_MIN_GRAIN_SIZE = 1UL << 10;
+
 class ProverRandomWidget {
   protected:
     typedef barretenberg::fr fr;
@@ -47,7 +52,8 @@ class ProverRandomWidget {
     virtual void compute_round_commitments(transcript::StandardTranscript&, const size_t, work_queue&){};
 
     virtual barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                           const transcript::StandardTranscript& transcript) = 0;
+                                                           const transcript::StandardTranscript& transcript,
+                                                           const plonk::quotient_block& block) = 0;
 
     proving_key* key;
 };
@@ -7,6 +7,7 @@
 
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "../../types/prover_settings.hpp"
+#include "../../types/quotient_block.hpp"
 #include "../../../../proof_system/proving_key/proving_key.hpp"
 #include "../../../../proof_system/work_queue/work_queue.hpp"
 using namespace bonk;
@@ -217,15 +218,18 @@ class FFTGetter : public BaseGetter<Field, Transcript, Settings, num_widget_rela
     typedef containers::poly_ptr_map<Field> poly_ptr_map;
 
   public:
-    static poly_ptr_map get_polynomials(proving_key* key, std::set<PolynomialIndex> required_polynomial_ids)
+    static poly_ptr_map get_polynomials(proving_key* key,
+                                        std::set<PolynomialIndex> required_polynomial_ids,
+                                        const quotient_block& block)
     {
         poly_ptr_map result;
         std::string label_suffix;
 
         // Set block_mask and index_shift
         label_suffix = "_fft"; // coset evaluation form has suffix "_fft"
-        result.block_mask = key->large_domain.size - 1;
-        result.index_shift = 4; // for coset fft, x->ω*x corresponds to shift by 4
+        result.block_mask = block.domain.size - 1;
+        // for coset fft, x->ω*x corresponds to shift by 4 (by 4 / num_blocks within a block of the coset)
+        result.index_shift = block.index_shift;
 
         // Construct the container of pointers to the required polynomials
         for (size_t i = 0; i < key->polynomial_manifest.size(); ++i) {
@@ -269,7 +273,9 @@ template <class Field> class TransitionWidgetBase {
     };
     virtual ~TransitionWidgetBase() {}
 
-    virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+    virtual Field compute_quotient_contribution(const Field&,
+                                                const transcript::StandardTranscript&,
+                                                const quotient_block&) = 0;
 
   public:
     proving_key* key;
@@ -310,7 +316,8 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
     };
 
     Field compute_quotient_contribution(const Field& alpha_base,
-                                        const transcript::StandardTranscript& transcript) override
+                                        const transcript::StandardTranscript& transcript,
+                                        const quotient_block& block) override
     {
         auto* key = TransitionWidgetBase<Field>::key;
 
@@ -318,19 +325,20 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         auto& required_polynomial_ids = FFTKernel::get_required_polynomial_ids();
 
         // Construct the map of pointers to the required polynomials
-        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
+        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids, block);
 
         challenge_array challenges =
             FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
 
-        ITERATE_OVER_DOMAIN_START(key->large_domain);
+        ITERATE_OVER_DOMAIN_START(block.domain);
         coefficient_array linear_terms;
         FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
         Field sum_of_linear_terms = FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
 
         // populate split quotient components
-        Field& quotient_term =
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
+        const size_t quotient_index = block.get_large_domain_index(i);
+        Field& quotient_term = key->quotient_polynomial_parts[quotient_index >> key->small_domain.log2_size]
+                                                             [quotient_index & (key->circuit_size - 1)];
         quotient_term += sum_of_linear_terms;
         FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient_term, i);
         ITERATE_OVER_DOMAIN_END;
@@ -31,6 +31,7 @@ Polynomial<Fr>::Polynomial(std::string const& filename)
     coefficients_ = (Fr*)mmap(0, len, PROT_READ, MAP_PRIVATE, fd, 0);
 #else
     coefficients_ = allocate_aligned_memory(len);
+    pooled_ = true;
     ::read(fd, (void*)coefficients_, len);
 #endif
     close(fd);
@@ -41,6 +42,7 @@ Polynomial<Fr>::Polynomial(const size_t size_)
     : coefficients_(nullptr)
     , size_(size_)
     , mapped_(false)
+    , pooled_(true)
 {
     if (capacity() > 0) {
         coefficients_ = allocate_aligned_memory(sizeof(Fr) * capacity());
@@ -52,6 +54,7 @@ template <typename Fr>
 Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
     : size_(std::max(target_size, other.size()))
     , mapped_(false)
+    , pooled_(true)
 {
     coefficients_ = allocate_aligned_memory(sizeof(Fr) * capacity());
 
@@ -66,6 +69,8 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     : coefficients_(std::exchange(other.coefficients_, nullptr))
     , size_(std::exchange(other.size_, 0))
     , mapped_(std::exchange(other.mapped_, false))
+    , pooled_(std::exchange(other.pooled_, false))
+    , backing_(std::move(other.backing_))
 {}
 
 template <typename Fr>
@@ -75,11 +80,20 @@ Polynomial<Fr>::Polynomial(Fr* buf, const size_t size_)
     , mapped_(false)
 {}
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(std::shared_ptr<void> backing, Fr* buf, const size_t size_)
+    : coefficients_(buf)
+    , size_(size_)
+    , mapped_(true)
+    , backing_(std::move(backing))
+{}
+
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomial<Fr>& other)
 {
     if (is_empty()) {
         size_ = other.size();
         coefficients_ = allocate_aligned_memory(sizeof(Fr) * other.capacity());
+        pooled_ = true;
     }
 
     ASSERT(in_place_operation_viable(other.size_));
@@ -103,6 +117,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(Polynomial&& ot
     coefficients_ = std::exchange(other.coefficients_, nullptr);
     size_ = std::exchange(other.size_, 0);
     mapped_ = std::exchange(other.mapped_, false);
+    pooled_ = std::exchange(other.pooled_, false);
+    backing_ = std::move(other.backing_);
 
     return *this;
 }
@@ -148,18 +164,23 @@ template <typename Fr> void Polynomial<Fr>::zero_memory_beyond(const size_t star
 
 template <typename Fr> void Polynomial<Fr>::free()
 {
-    if (coefficients_ != nullptr) {
+    if (backing_) {
+        backing_.reset();
+    } else if (coefficients_ != nullptr) {
+        if (pooled_) {
+            free_aligned_memory(coefficients_);
+        }
 #ifndef __wasm__
-        if (mapped_) {
+        else if (mapped_) {
             munmap(coefficients_, size_ * sizeof(Fr));
-        } else {
-            aligned_free(coefficients_);
         }
-#else
-        aligned_free(coefficients_);
 #endif
+        else {
+            aligned_free(coefficients_);
+        }
     }
     coefficients_ = nullptr;
+    pooled_ = false;
 }
 
 /**
@@ -364,7 +385,7 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
     }
     Fr result = tmp[0];
     // free the temporary buffer
-    aligned_free(tmp);
+    free_aligned_memory(tmp);
     return result;
 }
 
@@ -8,6 +8,7 @@
 #include <concepts>
 #include <span>
 #include "polynomial_arithmetic.hpp"
+#include "polynomial_arena.hpp"
 
 namespace barretenberg {
 template <typename Fr> class Polynomial {
@@ -23,6 +24,9 @@ template <typename Fr> class Polynomial {
     // Takes ownership of given buffer.
     Polynomial(Fr* buf, const size_t initial_size);
 
+    // Creates a read only view of the given buffer, which lies in memory (e.g. a mapped file) kept alive by `backing`.
+    Polynomial(std::shared_ptr<void> backing, Fr* buf, const size_t initial_size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -46,6 +50,7 @@ template <typename Fr> class Polynomial {
         coefficients_ = 0;
         size_ = 0;
         mapped_ = false;
+        pooled_ = false;
     }
 
     bool operator==(Polynomial const& rhs) const
@@ -125,7 +130,12 @@ template <typename Fr> class Polynomial {
     // safety check for in place operations
     bool in_place_operation_viable(size_t domain_size = 0) { return !mapped() && (size() >= domain_size); }
 
-    Fr* allocate_aligned_memory(const size_t size) const { return static_cast<Fr*>(aligned_alloc(sizeof(Fr), size)); }
+    // Memory from the polynomial arena; it goes back through free_aligned_memory
+    Fr* allocate_aligned_memory(const size_t size) const
+    {
+        return static_cast<Fr*>(get_polynomial_arena().allocate(size));
+    }
+    void free_aligned_memory(Fr* memory) const { get_polynomial_arena().deallocate(memory); }
 
     /**
      * @brief Returns an std::span of the left-shift of self.
@@ -233,6 +243,10 @@ template <typename Fr> class Polynomial {
     // polynomial.
     size_t size_ = 0;
     bool mapped_ = false;
+    // Whether coefficients_ came from the polynomial arena (rather than from the caller, or a mapped file)
+    bool pooled_ = false;
+    // Owner of the memory behind a read only view; such a polynomial never frees coefficients_ itself
+    std::shared_ptr<void> backing_;
 };
 
 template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynomial<Fr> const& p)
@@ -0,0 +1,222 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
+#include <array>
+
+namespace barretenberg {
+
+namespace {
+// Every block starts with a header recording its size; the caller's memory follows it
+constexpr size_t HEADER_SIZE = 64;
+constexpr uint64_t HEADER_MAGIC = 0x6172656e61706f6cULL;
+constexpr size_t PAGE_SIZE = 1UL << 12;
+
+struct block_header {
+    uint64_t magic;
+    size_t block_size;
+};
+} // namespace
+
+struct PolynomialArena::thread_cache {
+    ~thread_cache()
+    {
+        for (size_t i = 0; i < num_blocks; ++i) {
+            arena->thread_cache_bytes_ -= blocks[i].second;
+            arena->cache_or_free(blocks[i].first, blocks[i].second);
+        }
+    }
+
+    PolynomialArena* arena;
+    std::array<std::pair<void*, size_t>, THREAD_CACHE_SIZE> blocks;
+    size_t num_blocks = 0;
+};
+
+PolynomialArena::thread_cache& PolynomialArena::get_thread_cache()
+{
+    thread_local thread_cache cache{ &get_polynomial_arena(), {}, 0 };
+    return cache;
+}
+
+size_t PolynomialArena::get_block_size(const size_t num_bytes) const
+{
+    size_t block_size = num_bytes + HEADER_SIZE;
+    if (block_size < MIN_MAPPED_BLOCK_SIZE) {
+        return pad(block_size, HEADER_SIZE);
+    }
+    // Blocks smaller than a huge page are rounded up to ordinary pages, and mapped with them
+    const size_t huge_page_size = get_memory_policy(MemoryClass::POLYNOMIAL).get_page_size();
+    return pad(block_size, (block_size >= huge_page_size) ? huge_page_size : PAGE_SIZE);
+}
+
+void* PolynomialArena::allocate_block(const size_t block_size)
+{
+    if (block_size >= MIN_MAPPED_BLOCK_SIZE) {
+        memory_policy policy = get_memory_policy(MemoryClass::POLYNOMIAL);
+        if (block_size % policy.get_page_size() != 0) {
+            policy.huge_pages = HugePages::NONE;
+        }
+        void* block = map_pages(block_size, policy);
+        if (block == nullptr) {
+            info("bad alloc of size: ", block_size);
+            std::abort();
+        }
+        return block;
+    }
+    return aligned_alloc(HEADER_SIZE, block_size);
+}
+
+void PolynomialArena::free_block(void* block, const size_t block_size)
+{
+    if (block_size >= MIN_MAPPED_BLOCK_SIZE) {
+        unmap_pages(block, block_size);
+        return;
+    }
+    aligned_free(block);
+}
+
+void* PolynomialArena::allocate(const size_t num_bytes)
+{
+    const size_t block_size = get_block_size(num_bytes);
+    void* block = nullptr;
+
+    thread_cache& cache = get_thread_cache();
+    if (cache.arena == this) {
+        for (size_t i = 0; i < cache.num_blocks; ++i) {
+            if (cache.blocks[i].second == block_size) {
+                block = cache.blocks[i].first;
+                cache.blocks[i] = cache.blocks[--cache.num_blocks];
+                thread_cache_bytes_ -= block_size;
+                break;
+            }
+        }
+    }
+
+    std::vector<std::pair<void*, size_t>> released;
+    if (block == nullptr) {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        auto free_list = free_lists_.find(block_size);
+        if (free_list != free_lists_.end() && !free_list->second.empty()) {
+            block = free_list->second.back();
+            free_list->second.pop_back();
+            free_list_bytes_ -= block_size;
+        } else {
+            // The cached blocks of other sizes evidently are not what the caller is using now. Release enough of them
+            // to cover the new block, so that a change of circuit size does not leave the old sizes cached for good.
+            size_t released_bytes = 0;
+            for (auto& [other_block_size, blocks] : free_lists_) {
+                while (!blocks.empty() && released_bytes < block_size) {
+                    released.emplace_back(blocks.back(), other_block_size);
+                    blocks.pop_back();
+                    free_list_bytes_ -= other_block_size;
+                    released_bytes += other_block_size;
+                }
+            }
+        }
+    }
+    for (auto& [released_block, released_block_size] : released) {
+        free_block(released_block, released_block_size);
+    }
+
+    if (block == nullptr) {
+        ++num_misses_;
+        block = allocate_block(block_size);
+    } else {
+        ++num_hits_;
+    }
+
+    auto* header = static_cast<block_header*>(block);
+    header->magic = HEADER_MAGIC;
+    header->block_size = block_size;
+
+    const size_t bytes_live = bytes_live_ += block_size;
+    size_t peak_bytes_live = peak_bytes_live_;
+    while (bytes_live > peak_bytes_live && !peak_bytes_live_.compare_exchange_weak(peak_bytes_live, bytes_live)) {
+    }
+    return static_cast<uint8_t*>(block) + HEADER_SIZE;
+}
+
+void PolynomialArena::deallocate(void* ptr)
+{
+    void* block = static_cast<uint8_t*>(ptr) - HEADER_SIZE;
+    const auto* header = static_cast<block_header*>(block);
+    ASSERT(header->magic == HEADER_MAGIC);
+    const size_t block_size = header->block_size;
+    bytes_live_ -= block_size;
+
+    thread_cache& cache = get_thread_cache();
+    if (cache.arena == this && cache.num_blocks < THREAD_CACHE_SIZE) {
+        cache.blocks[cache.num_blocks++] = { block, block_size };
+        thread_cache_bytes_ += block_size;
+        return;
+    }
+    cache_or_free(block, block_size);
+}
+
+void PolynomialArena::cache_or_free(void* block, const size_t block_size)
+{
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        if (free_list_bytes_ + block_size <= max_cached_bytes_) {
+            free_lists_[block_size].push_back(block);
+            free_list_bytes_ += block_size;
+            return;
+        }
+    }
+    free_block(block, block_size);
+}
+
+void PolynomialArena::trim()
+{
+    thread_cache& cache = get_thread_cache();
+    if (cache.arena == this) {
+        for (size_t i = 0; i < cache.num_blocks; ++i) {
+            thread_cache_bytes_ -= cache.blocks[i].second;
+            free_block(cache.blocks[i].first, cache.blocks[i].second);
+        }
+        cache.num_blocks = 0;
+    }
+
+    std::unordered_map<size_t, std::vector<void*>> free_lists;
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        std::swap(free_lists, free_lists_);
+        free_list_bytes_ = 0;
+    }
+    for (auto& [block_size, blocks] : free_lists) {
+        for (void* block : blocks) {
+            free_block(block, block_size);
+        }
+    }
+}
+
+polynomial_arena_stats PolynomialArena::get_stats() const
+{
+    polynomial_arena_stats stats;
+    {
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(mutex_);
+#endif
+        stats.bytes_cached = free_list_bytes_;
+    }
+    stats.bytes_cached += thread_cache_bytes_;
+    stats.bytes_live = bytes_live_;
+    stats.peak_bytes_live = peak_bytes_live_;
+    stats.num_hits = num_hits_;
+    stats.num_misses = num_misses_;
+    return stats;
+}
+
+PolynomialArena& get_polynomial_arena()
+{
+    // Never destroyed: polynomials with static storage duration, and the thread caches, may outlive any destructor
+    static auto* arena = new PolynomialArena();
+    return *arena;
+}
+
+} // namespace barretenberg
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace barretenberg {
+
+struct polynomial_arena_stats {
+    // bytes handed out and not yet returned (by size class, so including rounding)
+    size_t bytes_live = 0;
+    // high-water mark of bytes_live
+    size_t peak_bytes_live = 0;
+    // bytes of returned blocks the arena is holding on to, in its free lists and in the thread caches
+    size_t bytes_cached = 0;
+    // allocations served from a free list or a thread cache
+    size_t num_hits = 0;
+    // allocations that needed new memory
+    size_t num_misses = 0;
+};
+
+/**
+ * A process-wide allocator for polynomial coefficients.
+ *
+ * A proof constructs and destroys hundreds of n and 4n sized polynomials, and the next proof repeats exactly the same
+ * sequence of sizes. Rather than handing these back to malloc (and, for the large ones, the OS), the arena keeps
+ * returned blocks in free lists keyed by size class and hands them out again. Once a proof has run, a proof of the same
+ * circuit allocates no new memory and takes no page faults for its polynomials.
+ *
+ * Blocks of at least MIN_MAPPED_BLOCK_SIZE bytes are mapped from the OS directly, rounded up to pages, under the memory
+ * policy of MemoryClass::POLYNOMIAL (see common/mem.hpp), which may ask for huge pages or NUMA placement. Each thread
+ * also keeps a few returned blocks in a cache of its own, so that the threads of a parallel loop do not contend on the
+ * arena's lock.
+ *
+ * Cached memory is not held on to without limit: when an allocation cannot be served from the cache, blocks of other
+ * size classes are released first, so that the arena's footprint (live plus cached bytes) only grows when the live
+ * bytes do. `trim` releases the free lists and the calling thread's cache. The caches of other threads (at most
+ * THREAD_CACHE_SIZE blocks each) are not theirs to touch: those blocks are released once their thread hands them back
+ * to the free lists, or exits.
+ */
+class PolynomialArena {
+  public:
+    // Blocks smaller than this come from aligned_alloc rather than mmap
+    static constexpr size_t MIN_MAPPED_BLOCK_SIZE = 1UL << 16;
+    // Number of returned blocks each thread keeps for itself
+    static constexpr size_t THREAD_CACHE_SIZE = 4;
+
+    PolynomialArena() = default;
+    PolynomialArena(const PolynomialArena& other) = delete;
+    PolynomialArena& operator=(const PolynomialArena& other) = delete;
+
+    // Returns memory for `num_bytes` bytes, aligned to at least 64 bytes
+    void* allocate(const size_t num_bytes);
+    void deallocate(void* ptr);
+
+    // Release every block held by the arena's free lists and by the calling thread's cache back to the system
+    void trim();
+
+    // Upper bound on the bytes the free lists hold; a returned block that would exceed it is released instead
+    void set_max_cached_bytes(const size_t max_cached_bytes) { max_cached_bytes_ = max_cached_bytes; }
+
+    polynomial_arena_stats get_stats() const;
+
+  private:
+    struct thread_cache;
+
+    size_t get_block_size(const size_t num_bytes) const;
+    void* allocate_block(const size_t block_size);
+    void free_block(void* block, const size_t block_size);
+    void cache_or_free(void* block, const size_t block_size);
+    thread_cache& get_thread_cache();
+
+    std::unordered_map<size_t, std::vector<void*>> free_lists_;
+    size_t free_list_bytes_ = 0;
+    size_t max_cached_bytes_ = SIZE_MAX;
+    std::atomic<size_t> bytes_live_ = 0;
+    std::atomic<size_t> peak_bytes_live_ = 0;
+    std::atomic<size_t> thread_cache_bytes_ = 0;
+    std::atomic<size_t> num_hits_ = 0;
+    std::atomic<size_t> num_misses_ = 0;
+#ifndef NO_MULTITHREADING
+    mutable std::mutex mutex_;
+#endif
+};
+
+/**
+ * The process-wide arena that every Polynomial allocates from.
+ */
+PolynomialArena& get_polynomial_arena();
+
+} // namespace barretenberg
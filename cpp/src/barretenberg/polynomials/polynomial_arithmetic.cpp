@@ -2,31 +2,125 @@
 #include "iterate_over_domain.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "polynomial_arena.hpp"
+#include <algorithm>
+#include <array>
 #include <math.h>
 #include <memory.h>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 namespace barretenberg::polynomial_arithmetic {
 
 namespace {
 
-template <typename Fr> Fr* get_scratch_space(const size_t num_elements)
+// Number of twiddle products (and coset powers) handed to `Fr::mul_batch` at a time. Large enough to amortise the
+// transposition into the vectorised kernel's layout, small enough to keep the products on the stack
+constexpr size_t MUL_BATCH_BLOCK_SIZE = 64;
+
+// Smallest range of elements handed to one thread by `parallel_for`: a few whole blocks, so the per-range setup (a
+// power of the coset generator, a twiddle row) stays small next to the range's work
+constexpr size_t MIN_GRAIN_SIZE = 4 * MUL_BATCH_BLOCK_SIZE;
+
+// Number of sub-FFTs the four-step FFT runs side by side (see `fft_inner_four_step`). Each thread buffers this many
+// sub-FFTs of ~sqrt(n) elements: 512 KB for a 2^22 domain
+constexpr size_t FOUR_STEP_FFT_WIDTH = 8;
+
+// Maximum number of sequences `fft_interleaved` transforms side by side
+constexpr size_t INTERLEAVED_FFT_MAX_WIDTH = BATCH_FFT_MAX_POLYS * FOUR_STEP_FFT_WIDTH;
+
+/**
+ * Scratch memory for one call. FFTs run concurrently (a proof's IFFTs are separate work queue jobs, and a ProverPool
+ * runs several proofs at once), so no two calls may share a buffer: each takes a block of its own from the polynomial
+ * arena, which hands the same blocks out again from one proof to the next rather than allocating them afresh.
+ */
+template <typename Fr> class ScratchSpace {
+  public:
+    explicit ScratchSpace(const size_t num_elements)
+        : data_(static_cast<Fr*>(get_polynomial_arena().allocate(num_elements * sizeof(Fr))))
+    {}
+    ScratchSpace(const ScratchSpace& other) = delete;
+    ScratchSpace& operator=(const ScratchSpace& other) = delete;
+    ~ScratchSpace() { get_polynomial_arena().deallocate(data_); }
+
+    Fr* get() const { return data_; }
+
+  private:
+    Fr* data_;
+};
+
+size_t fft_log2_radix = DEFAULT_FFT_LOG2_RADIX;
+
+/**
+ * One pass of a radix-2^`log2_radix` FFT: rounds m, 2m, ..., (2^(log2_radix - 1))m of the radix-2 butterfly network,
+ * for butterfly groups [start, end).
+ * Group i acts on the `radix` elements at `(i - (i % m)) * radix + (i % m) + t * m`, which no other group touches
+ * during these rounds, so each element is loaded and stored once per pass rather than once per round. The roots of
+ * unity are those of the radix-2 rounds, read from `root_table`.
+ * `input` and `output` map an element index to its location. Groups are processed `block_size` at a time, so that the
+ * twiddle products of each butterfly are a single call to `Fr::mul_batch`: `block_size` must divide `m`, and the two
+ * maps must return contiguous runs of `block_size` elements.
+ **/
+template <typename Fr, typename Input, typename Output>
+void fft_radix_pass(const Input& input,
+                    const Output& output,
+                    const std::vector<Fr*>& root_table,
+                    const size_t m,
+                    const size_t log2_radix,
+                    const size_t start,
+                    const size_t end,
+                    const size_t block_size)
 {
-    static Fr* working_memory = nullptr;
-    static size_t current_size = 0;
-    if (num_elements > current_size) {
-        if (working_memory) {
-            aligned_free(working_memory);
+    const size_t radix = 1UL << log2_radix;
+    const size_t log2_m = static_cast<size_t>(numeric::get_msb(m));
+    std::array<Fr, MUL_BATCH_BLOCK_SIZE> temps;
+    std::array<Fr*, 1UL << MAX_FFT_LOG2_RADIX> rows;
+    for (size_t i = start; i < end; i += block_size) {
+        const size_t j = i & (m - 1);
+        const size_t group_start = (i - j) << log2_radix;
+        for (size_t t = 0; t < radix; ++t) {
+            rows[t] = input(group_start + t * m + j);
+        }
+        // round s pairs row t with row t + 2^s. Relative to the radix-2 round of half-size (m << s), row t sits at
+        // position (t % 2^s) * m + j of its butterfly group, which selects its root of unity
+        for (size_t s = 0; s < log2_radix; ++s) {
+            const size_t half = 1UL << s;
+            const Fr* round_roots = root_table[log2_m + s - 1] + j;
+            for (size_t t = 0; t < radix; ++t) {
+                if ((t & half) != 0) {
+                    continue;
+                }
+                Fr* even = rows[t];
+                Fr* odd = rows[t + half];
+                Fr::mul_batch(round_roots + (t & (half - 1)) * m, odd, temps.data(), block_size);
+                for (size_t k = 0; k < block_size; ++k) {
+                    odd[k] = even[k] - temps[k];
+                    even[k] += temps[k];
+                }
+            }
+        }
+        for (size_t t = 0; t < radix; ++t) {
+            Fr* target = output(group_start + t * m + j);
+            if (target != rows[t]) {
+                std::copy(rows[t], rows[t] + block_size, target);
+            }
         }
-        working_memory = (Fr*)(aligned_alloc(64, num_elements * sizeof(Fr)));
-        current_size = num_elements;
     }
-    return working_memory;
 }
 
 } // namespace
 
+void set_fft_log2_radix(const size_t log2_radix)
+{
+    ASSERT(log2_radix >= 1 && log2_radix <= MAX_FFT_LOG2_RADIX);
+    fft_log2_radix = log2_radix;
+}
+
+size_t get_fft_log2_radix()
+{
+    return fft_log2_radix;
+}
+
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
 {
     x = (((x & 0xaaaaaaaa) >> 1) | ((x & 0x55555555) << 1));
@@ -93,44 +187,52 @@ void fft_inner_serial(std::vector<Fr*> coeffs, const size_t domain_size, const s
         }
     }
 
-    for (size_t m = 2; m < domain_size; m *= 2) {
-        const size_t i = (size_t)numeric::get_msb(m);
-        for (size_t k = 0; k < domain_size; k += (2 * m)) {
-            for (size_t j = 0; j < m; ++j) {
-                const size_t even_poly_idx = (k + j) >> log2_poly_size;
-                const size_t even_elem_idx = (k + j) & (poly_domain_size - 1);
-                const size_t odd_poly_idx = (k + j + m) >> log2_poly_size;
-                const size_t odd_elem_idx = (k + j + m) & (poly_domain_size - 1);
-
-                temp = root_table[i - 1][j] * coeffs[odd_poly_idx][odd_elem_idx];
-                coeffs[odd_poly_idx][odd_elem_idx] = coeffs[even_poly_idx][even_elem_idx] - temp;
-                coeffs[even_poly_idx][even_elem_idx] += temp;
-            }
-        }
+    const size_t log2_radix = get_fft_log2_radix();
+    const auto elements = [&](const size_t index) {
+        return coeffs[index >> log2_poly_size] + (index & (poly_domain_size - 1));
+    };
+    size_t m = 2;
+    while (m < domain_size) {
+        const size_t pass_log2_radix = std::min(log2_radix, log2_size - static_cast<size_t>(numeric::get_msb(m)));
+        const size_t block_size = std::min({ MUL_BATCH_BLOCK_SIZE, m, poly_domain_size });
+        const size_t num_groups = domain_size >> pass_log2_radix;
+        fft_radix_pass(elements, elements, root_table, m, pass_log2_radix, 0, num_groups, block_size);
+        m <<= pass_log2_radix;
     }
 }
 
 template <typename Fr>
 void scale_by_generator(Fr* coeffs,
                         Fr* target,
-                        const EvaluationDomain<Fr>& domain,
+                        const EvaluationDomain<Fr>&,
                         const Fr& generator_start,
                         const Fr& generator_shift,
                         const size_t generator_size)
 {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < domain.num_threads; ++j) {
-        Fr thread_shift = generator_shift.pow(static_cast<uint64_t>(j * (generator_size / domain.num_threads)));
-        Fr work_generator = generator_start * thread_shift;
-        const size_t offset = j * (generator_size / domain.num_threads);
-        const size_t end = offset + (generator_size / domain.num_threads);
-        for (size_t i = offset; i < end; ++i) {
-            target[i] = coeffs[i] * work_generator;
-            work_generator *= generator_shift;
-        }
-    }
+    // ranges are whole blocks, so every range but the last is scaled in full blocks
+    parallel_for(
+        generator_size,
+        [&](const size_t start, const size_t end) {
+            Fr work_generator = generator_start * generator_shift.pow(static_cast<uint64_t>(start));
+
+            // Rather than stepping `work_generator` once per coefficient (a chain of dependent multiplications),
+            // scale a block of coefficients at a time by `work_generator * generator_shift^k`, k = 0, ..., block
+            // size - 1
+            std::array<Fr, MUL_BATCH_BLOCK_SIZE> shift_powers;
+            std::array<Fr, MUL_BATCH_BLOCK_SIZE> block_powers;
+            shift_powers[0] = Fr::one();
+            for (size_t k = 1; k < MUL_BATCH_BLOCK_SIZE; ++k) {
+                shift_powers[k] = shift_powers[k - 1] * generator_shift;
+            }
+            const Fr block_shift = shift_powers[MUL_BATCH_BLOCK_SIZE - 1] * generator_shift;
+            for (size_t i = start; i < end; i += MUL_BATCH_BLOCK_SIZE) {
+                const size_t block_size = std::min(MUL_BATCH_BLOCK_SIZE, end - i);
+                Fr::mul_batch(shift_powers.data(), work_generator, block_powers.data(), block_size);
+                Fr::mul_batch(coeffs + i, block_powers.data(), target + i, block_size);
+                work_generator *= block_shift;
+            }
+        },
+        MIN_GRAIN_SIZE);
 }
 /**
  * Compute multiplicative subgroup (g.X)^n.
@@ -170,7 +272,8 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const Fr&,
                         const std::vector<Fr*>& root_table)
 {
-    Fr* scratch_space = get_scratch_space<Fr>(domain.size);
+    ScratchSpace<Fr> scratch(domain.size);
+    Fr* scratch_space = scratch.get();
 
     const size_t num_polys = coeffs.size();
     ASSERT(is_power_of_two(num_polys));
@@ -178,20 +281,16 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     ASSERT(is_power_of_two(poly_size));
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+    const size_t log2_radix = get_fft_log2_radix();
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    parallel_for(
+        domain.size >> 1,
+        [&](const size_t start, const size_t end) {
             Fr temp_1;
             Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            for (size_t i = 2 * start; i < 2 * end; i += 2) {
                 uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
                 uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
                 __builtin_prefetch(&coeffs[next_index_1]);
@@ -210,96 +309,35 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                 scratch_space[i + 1] = temp_1 - temp_2;
                 scratch_space[i] = temp_1 + temp_2;
             }
-        }
-
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0][0] = scratch_space[0];
-            coeffs[0][1] = scratch_space[1];
-        }
+        },
+        MIN_GRAIN_SIZE);
+
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0][0] = scratch_space[0];
+        coeffs[0][1] = scratch_space[1];
+    }
 
-        // outer FFT loop
-        for (size_t m = 2; m < (domain.size); m <<= 1) {
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                if (m != (domain.size >> 1)) {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                        scratch_space[k1 + j1] += temp;
-                    }
-                } else {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-
-                        size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                        size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                        size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                        size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                        coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                    }
-                }
-            }
-        }
+    // outer FFT loop: the remaining rounds, up to `log2_radix` of them per pass over the domain. The final pass
+    // writes its output to `coeffs` instead of `scratch_space`. Every range of groups is a whole number of blocks
+    size_t m = 2;
+    while (m < domain.size) {
+        const size_t pass_log2_radix =
+            std::min(log2_radix, domain.log2_size - static_cast<size_t>(numeric::get_msb(m)));
+        const bool final_pass = (m << pass_log2_radix) == domain.size;
+        const size_t block_size = std::min({ MUL_BATCH_BLOCK_SIZE, m, poly_size });
+        const auto input = [scratch_space](const size_t index) { return scratch_space + index; };
+        const auto output = [&](const size_t index) {
+            return final_pass ? coeffs[index >> log2_poly_size] + (index & poly_mask) : scratch_space + index;
+        };
+        parallel_for(
+            domain.size >> pass_log2_radix,
+            [&](const size_t start, const size_t end) {
+                fft_radix_pass(input, output, root_table, m, pass_log2_radix, start, end, block_size);
+            },
+            block_size);
+        m <<= pass_log2_radix;
     }
 }
 
@@ -307,19 +345,16 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+    const size_t log2_radix = get_fft_log2_radix();
+
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    parallel_for(
+        domain.size >> 1,
+        [&](const size_t start, const size_t end) {
             Fr temp_1;
             Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            for (size_t i = 2 * start; i < 2 * end; i += 2) {
                 uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
                 uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
                 __builtin_prefetch(&coeffs[next_index_1]);
@@ -333,83 +368,305 @@ void fft_inner_parallel(
                 target[i + 1] = temp_1 - temp_2;
                 target[i] = temp_1 + temp_2;
             }
-        }
+        },
+        MIN_GRAIN_SIZE);
+
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0] = target[0];
+        coeffs[1] = target[1];
+    }
 
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0] = target[0];
-            coeffs[1] = target[1];
-        }
+    // outer FFT loop: the remaining rounds, up to `log2_radix` of them per pass over the domain. Every range of groups
+    // is a whole number of blocks
+    size_t m = 2;
+    while (m < domain.size) {
+        const size_t pass_log2_radix =
+            std::min(log2_radix, domain.log2_size - static_cast<size_t>(numeric::get_msb(m)));
+        const size_t block_size = std::min(MUL_BATCH_BLOCK_SIZE, m);
+        const auto elements = [target](const size_t index) { return target + index; };
+        parallel_for(
+            domain.size >> pass_log2_radix,
+            [&](const size_t start, const size_t end) {
+                fft_radix_pass(elements, elements, root_table, m, pass_log2_radix, start, end, block_size);
+            },
+            block_size);
+        m <<= pass_log2_radix;
+    }
+}
 
-        // outer FFT loop
-        for (size_t m = 2; m < (domain.size); m <<= 1) {
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * target[k1 + j1 + m];
-                    target[k1 + j1 + m] = target[k1 + j1] - temp;
-                    target[k1 + j1] += temp;
+/**
+ * Radix-2 FFT of `width` (at most `INTERLEAVED_FFT_MAX_WIDTH`) interleaved sequences of length `length`: row r of
+ * `buffer` holds element r of every sequence. The rows must already be in bit-reversed order.
+ * Every butterfly acts on whole rows, so a row's twiddle products are a single call to `Fr::mul_batch`.
+ **/
+template <typename Fr>
+void fft_interleaved(Fr* buffer, const size_t length, const size_t width, const std::vector<Fr*>& root_table)
+{
+    ASSERT(width <= INTERLEAVED_FFT_MAX_WIDTH);
+    std::array<Fr, INTERLEAVED_FFT_MAX_WIDTH> temps;
+    for (size_t k = 0; k < length; k += 2) {
+        Fr* even = buffer + k * width;
+        Fr* odd = even + width;
+        for (size_t c = 0; c < width; ++c) {
+            Fr::__copy(odd[c], temps[c]);
+            odd[c] = even[c] - temps[c];
+            even[c] += temps[c];
+        }
+    }
+    for (size_t m = 2; m < length; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        for (size_t k = 0; k < length; k += (2 * m)) {
+            for (size_t j = 0; j < m; ++j) {
+                Fr* even = buffer + (k + j) * width;
+                Fr* odd = even + m * width;
+                Fr::mul_batch(odd, round_roots[j], temps.data(), width);
+                for (size_t c = 0; c < width; ++c) {
+                    odd[c] = even[c] - temps[c];
+                    even[c] += temps[c];
                 }
             }
         }
     }
 }
 
+template <typename Fr>
+bool use_four_step_fft(const EvaluationDomain<Fr>& domain, const size_t num_input_polys, const size_t num_output_polys)
+{
+    // the column and row blocks must not straddle two polynomials
+    const size_t num_polys = std::max(num_input_polys, num_output_polys);
+    return domain.log2_size >= FOUR_STEP_FFT_MIN_LOG_SIZE && is_power_of_two(num_polys) &&
+           domain.size / num_polys >= FOUR_STEP_FFT_WIDTH;
+}
+
+/**
+ * Four-step (Bailey) FFT.
+ *
+ * The radix-2 FFT makes log(n) passes over the whole domain; once the domain exceeds the caches, every pass streams it
+ * from memory. Here we split the domain size into n = n1 * n2 and view the input as an n2 x n1 matrix, with element
+ * j1 + n1 * j2 in row j2 and column j1. Then, with w the domain's root:
+ *
+ *     1. take the n2-point FFT of every column (the roots of unity of this FFT are w^n1)
+ *     2. multiply the element in row k2, column j1 by w^(j1 * k2)
+ *     3. take the n1-point FFT of every row (the roots of unity of this FFT are w^n2)
+ *
+ * and row k2, column k1 holds output k2 + n2 * k1. Steps 1 and 2 form one pass, from `coeffs` into scratch space, and
+ * step 3 forms a second pass, from scratch space into `target`, that also transposes the output into natural order.
+ *
+ * Each pass gathers `FOUR_STEP_FFT_WIDTH` columns (rows) at a time into a buffer that fits in L2, and runs
+ * their sub-FFTs side by side (see `fft_interleaved`). The sub-FFTs use the domain's own round roots, so the result is
+ * the same as that of `fft_inner_parallel`. Elements are reduced as lazily as there, so the two can differ in their
+ * [0, 2p) representation.
+ *
+ * `coeffs` and `target` may be the same polynomials, and may each be split into several polynomials of equal size.
+ **/
+template <typename Fr>
+void fft_inner_four_step(const std::vector<Fr*>& coeffs,
+                         const std::vector<Fr*>& target,
+                         const EvaluationDomain<Fr>& domain,
+                         const Fr& root,
+                         const std::vector<Fr*>& root_table)
+{
+    constexpr size_t width = FOUR_STEP_FFT_WIDTH;
+    const size_t log2_n1 = domain.log2_size / 2;
+    const size_t log2_n2 = domain.log2_size - log2_n1;
+    const size_t n1 = 1UL << log2_n1;
+    const size_t n2 = 1UL << log2_n2;
+    ASSERT(n1 >= width);
+
+    const size_t log2_input_size = domain.log2_size - static_cast<size_t>(numeric::get_msb(coeffs.size()));
+    const size_t log2_target_size = domain.log2_size - static_cast<size_t>(numeric::get_msb(target.size()));
+    const auto input = [&](const size_t i) {
+        return &coeffs[i >> log2_input_size][i & ((1UL << log2_input_size) - 1)];
+    };
+    const auto output = [&](const size_t i) {
+        return &target[i >> log2_target_size][i & ((1UL << log2_target_size) - 1)];
+    };
+
+    ScratchSpace<Fr> scratch(domain.size);
+    Fr* scratch_space = scratch.get();
+
+    // each range of blocks gathers into a buffer of its own
+    // steps 1 and 2: columns (j1 = column_start, ..., column_start + width - 1)
+    parallel_for(
+        n1 / width,
+        [&](const size_t blocks_start, const size_t blocks_end) {
+            std::vector<Fr> buffer(n2 * width);
+            std::array<Fr, width> twiddles;
+            std::array<Fr, width> twiddle_steps;
+            for (size_t block = blocks_start; block < blocks_end; ++block) {
+                const size_t column_start = block * width;
+                for (size_t j2 = 0; j2 < n2; ++j2) {
+                    const Fr* src = input(j2 * n1 + column_start);
+                    Fr* dest = &buffer[reverse_bits(static_cast<uint32_t>(j2), static_cast<uint32_t>(log2_n2)) * width];
+                    std::copy(src, src + width, dest);
+                }
+                fft_interleaved(buffer.data(), n2, width, root_table);
+
+                // row k2 of column j1 is scaled by w^(j1 * k2): step from row to row by multiplying with w^j1
+                twiddle_steps[0] = root.pow(static_cast<uint64_t>(column_start));
+                twiddles[0] = Fr::one();
+                for (size_t c = 1; c < width; ++c) {
+                    twiddle_steps[c] = twiddle_steps[c - 1] * root;
+                    twiddles[c] = Fr::one();
+                }
+                for (size_t k2 = 0; k2 < n2; ++k2) {
+                    Fr::mul_batch(&buffer[k2 * width], twiddles.data(), &scratch_space[k2 * n1 + column_start], width);
+                    Fr::mul_batch(twiddles.data(), twiddle_steps.data(), twiddles.data(), width);
+                }
+            }
+        },
+        1);
+
+    // step 3: rows (k2 = row_start, ..., row_start + width - 1)
+    parallel_for(
+        n2 / width,
+        [&](const size_t blocks_start, const size_t blocks_end) {
+            std::vector<Fr> buffer(n1 * width);
+            for (size_t block = blocks_start; block < blocks_end; ++block) {
+                const size_t row_start = block * width;
+                for (size_t j1 = 0; j1 < n1; ++j1) {
+                    Fr* dest = &buffer[reverse_bits(static_cast<uint32_t>(j1), static_cast<uint32_t>(log2_n1)) * width];
+                    for (size_t r = 0; r < width; ++r) {
+                        Fr::__copy(scratch_space[(row_start + r) * n1 + j1], dest[r]);
+                    }
+                }
+                fft_interleaved(buffer.data(), n1, width, root_table);
+                for (size_t k1 = 0; k1 < n1; ++k1) {
+                    std::copy(&buffer[k1 * width], &buffer[(k1 + 1) * width], output(k1 * n2 + row_start));
+                }
+            }
+        },
+        1);
+}
+
+/**
+ * Four-step FFT of up to `BATCH_FFT_MAX_POLYS` polynomials in lockstep, in place. Coefficient i of every polynomial is
+ * first multiplied by generator^i (pass one for a plain FFT).
+ *
+ * As `fft_inner_four_step`, except that a block gathers the same few columns (rows) of every polynomial into the
+ * interleaved buffer. Each root of unity of the sub-FFTs is then loaded once per butterfly and multiplied into all of
+ * the polynomials, and the step 2 twiddles and the coset powers are computed once per block rather than once per
+ * polynomial. The coset powers are applied while gathering the columns, which saves the separate pass of
+ * `scale_by_generator`. Step 1 writes to a scratch copy of the polynomials, allocated for the duration of the call.
+ **/
+template <typename Fr>
+void fft_inner_four_step_batch(const std::vector<Fr*>& polys,
+                               const EvaluationDomain<Fr>& domain,
+                               const Fr& root,
+                               const std::vector<Fr*>& root_table,
+                               const Fr& generator)
+{
+    const size_t num_polys = polys.size();
+    ASSERT(num_polys > 0 && num_polys <= BATCH_FFT_MAX_POLYS);
+    // columns (rows) per polynomial in a block. As many as in `fft_inner_four_step`: with fewer, the column gathers
+    // touch more pages per column of output, and the TLB misses outweigh the shared twiddle factors
+    constexpr size_t lanes_per_poly = FOUR_STEP_FFT_WIDTH;
+    const size_t width = lanes_per_poly * num_polys;
+    const size_t log2_n1 = domain.log2_size / 2;
+    const size_t log2_n2 = domain.log2_size - log2_n1;
+    const size_t n1 = 1UL << log2_n1;
+    const size_t n2 = 1UL << log2_n2;
+    ASSERT(width <= INTERLEAVED_FFT_MAX_WIDTH);
+    ASSERT(n1 >= lanes_per_poly);
+
+    const bool is_coset = !(generator == Fr::one());
+    // moves a coset power from row j2 to row j2 + 1 of its column
+    const Fr generator_step = generator.pow(static_cast<uint64_t>(n1));
+
+    ScratchSpace<Fr> scratch(num_polys * domain.size);
+    Fr* scratch_space = scratch.get();
+
+    // each range of blocks gathers into a buffer of its own
+    // steps 1 and 2: columns (j1 = column_start, ..., column_start + lanes_per_poly - 1)
+    parallel_for(
+        n1 / lanes_per_poly,
+        [&](const size_t blocks_start, const size_t blocks_end) {
+            std::vector<Fr> buffer(n2 * width);
+            // one entry per column of the block. `lane_factors` repeats them for every polynomial
+            std::array<Fr, FOUR_STEP_FFT_WIDTH> coset_powers;
+            std::array<Fr, FOUR_STEP_FFT_WIDTH> twiddles;
+            std::array<Fr, FOUR_STEP_FFT_WIDTH> twiddle_steps;
+            std::array<Fr, INTERLEAVED_FFT_MAX_WIDTH> lane_factors;
+            const auto repeat_for_polys = [&](const std::array<Fr, FOUR_STEP_FFT_WIDTH>& factors) {
+                for (size_t p = 0; p < num_polys; ++p) {
+                    std::copy(factors.begin(), factors.end(), &lane_factors[p * lanes_per_poly]);
+                }
+            };
+            for (size_t block = blocks_start; block < blocks_end; ++block) {
+                const size_t column_start = block * lanes_per_poly;
+                if (is_coset) {
+                    coset_powers[0] = generator.pow(static_cast<uint64_t>(column_start));
+                    for (size_t c = 1; c < lanes_per_poly; ++c) {
+                        coset_powers[c] = coset_powers[c - 1] * generator;
+                    }
+                }
+                for (size_t j2 = 0; j2 < n2; ++j2) {
+                    Fr* dest = &buffer[reverse_bits(static_cast<uint32_t>(j2), static_cast<uint32_t>(log2_n2)) * width];
+                    for (size_t p = 0; p < num_polys; ++p) {
+                        const Fr* src = polys[p] + j2 * n1 + column_start;
+                        std::copy(src, src + lanes_per_poly, dest + p * lanes_per_poly);
+                    }
+                    if (is_coset) {
+                        repeat_for_polys(coset_powers);
+                        Fr::mul_batch(dest, lane_factors.data(), dest, width);
+                        Fr::mul_batch(coset_powers.data(), generator_step, coset_powers.data(), lanes_per_poly);
+                    }
+                }
+                fft_interleaved(buffer.data(), n2, width, root_table);
+
+                twiddle_steps[0] = root.pow(static_cast<uint64_t>(column_start));
+                twiddles[0] = Fr::one();
+                for (size_t c = 1; c < lanes_per_poly; ++c) {
+                    twiddle_steps[c] = twiddle_steps[c - 1] * root;
+                    twiddles[c] = Fr::one();
+                }
+                for (size_t k2 = 0; k2 < n2; ++k2) {
+                    Fr* row = &buffer[k2 * width];
+                    repeat_for_polys(twiddles);
+                    Fr::mul_batch(row, lane_factors.data(), row, width);
+                    for (size_t p = 0; p < num_polys; ++p) {
+                        std::copy(row + p * lanes_per_poly,
+                                  row + (p + 1) * lanes_per_poly,
+                                  &scratch_space[p * domain.size + k2 * n1 + column_start]);
+                    }
+                    Fr::mul_batch(twiddles.data(), twiddle_steps.data(), twiddles.data(), lanes_per_poly);
+                }
+            }
+        },
+        1);
+
+    // step 3: rows (k2 = row_start, ..., row_start + lanes_per_poly - 1)
+    parallel_for(
+        n2 / lanes_per_poly,
+        [&](const size_t blocks_start, const size_t blocks_end) {
+            std::vector<Fr> buffer(n1 * width);
+            for (size_t block = blocks_start; block < blocks_end; ++block) {
+                const size_t row_start = block * lanes_per_poly;
+                for (size_t j1 = 0; j1 < n1; ++j1) {
+                    Fr* dest = &buffer[reverse_bits(static_cast<uint32_t>(j1), static_cast<uint32_t>(log2_n1)) * width];
+                    for (size_t p = 0; p < num_polys; ++p) {
+                        const Fr* src = &scratch_space[p * domain.size + row_start * n1 + j1];
+                        for (size_t r = 0; r < lanes_per_poly; ++r) {
+                            Fr::__copy(src[r * n1], dest[p * lanes_per_poly + r]);
+                        }
+                    }
+                }
+                fft_interleaved(buffer.data(), n1, width, root_table);
+                for (size_t k1 = 0; k1 < n1; ++k1) {
+                    const Fr* row = &buffer[k1 * width];
+                    for (size_t p = 0; p < num_polys; ++p) {
+                        std::copy(row + p * lanes_per_poly,
+                                  row + (p + 1) * lanes_per_poly,
+                                  polys[p] + k1 * n2 + row_start);
+                    }
+                }
+            }
+        },
+        1);
+}
+
 template <typename Fr>
 void partial_fft_serial_inner(Fr* coeffs,
                               Fr* target,
@@ -535,22 +792,38 @@ template <typename Fr> void partial_fft(Fr* coeffs, const EvaluationDomain<Fr>&
 
 template <typename Fr> void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
+    if (use_four_step_fft(domain, 1, 1)) {
+        fft_inner_four_step({ coeffs }, { coeffs }, domain, domain.root, domain.get_round_roots());
+        return;
+    }
     fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr> void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
+    if (use_four_step_fft(domain, 1, 1)) {
+        fft_inner_four_step({ coeffs }, { target }, domain, domain.root, domain.get_round_roots());
+        return;
+    }
     fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr> void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
+    if (use_four_step_fft(domain, coeffs.size(), coeffs.size())) {
+        fft_inner_four_step(coeffs, coeffs, domain, domain.root, domain.get_round_roots());
+        return;
+    }
     fft_inner_parallel<Fr>(coeffs, domain.size, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr> void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    if (use_four_step_fft(domain, 1, 1)) {
+        fft_inner_four_step({ coeffs }, { coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    } else {
+        fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    }
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -558,7 +831,11 @@ template <typename Fr> void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 
 template <typename Fr> void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    if (use_four_step_fft(domain, 1, 1)) {
+        fft_inner_four_step({ coeffs }, { target }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    } else {
+        fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    }
     ITERATE_OVER_DOMAIN_START(domain);
     target[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -566,7 +843,11 @@ template <typename Fr> void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<
 
 template <typename Fr> void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    if (use_four_step_fft(domain, coeffs.size(), coeffs.size())) {
+        fft_inner_four_step(coeffs, coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    } else {
+        fft_inner_parallel(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    }
 
     const size_t num_polys = coeffs.size();
     ASSERT(is_power_of_two(num_polys));
@@ -582,7 +863,7 @@ template <typename Fr> void ifft(std::vector<Fr*> coeffs, const EvaluationDomain
 
 template <typename Fr> void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft(coeffs, domain);
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= value;
     ITERATE_OVER_DOMAIN_END;
@@ -615,6 +896,40 @@ template <typename Fr> void coset_fft(std::vector<Fr*> coeffs, const EvaluationD
     fft(coeffs, domain);
 }
 
+template <typename Fr> void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    if (polys.size() < 2 || !use_four_step_fft(domain, 1, 1)) {
+        for (Fr* poly : polys) {
+            fft(poly, domain);
+        }
+        return;
+    }
+    for (size_t i = 0; i < polys.size(); i += BATCH_FFT_MAX_POLYS) {
+        const auto first = polys.begin() + static_cast<std::ptrdiff_t>(i);
+        const auto last = polys.begin() + static_cast<std::ptrdiff_t>(std::min(i + BATCH_FFT_MAX_POLYS, polys.size()));
+        const std::vector<Fr*> chunk(first, last);
+        fft_inner_four_step_batch(chunk, domain, domain.root, domain.get_round_roots(), Fr::one());
+    }
+}
+
+template <typename Fr> void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    // the batched kernel scales every coefficient by its coset power, whereas `scale_by_generator` leaves those past
+    // `generator_size` as they are
+    if (polys.size() < 2 || !use_four_step_fft(domain, 1, 1) || domain.generator_size != domain.size) {
+        for (Fr* poly : polys) {
+            coset_fft(poly, domain);
+        }
+        return;
+    }
+    for (size_t i = 0; i < polys.size(); i += BATCH_FFT_MAX_POLYS) {
+        const auto first = polys.begin() + static_cast<std::ptrdiff_t>(i);
+        const auto last = polys.begin() + static_cast<std::ptrdiff_t>(std::min(i + BATCH_FFT_MAX_POLYS, polys.size()));
+        const std::vector<Fr*> chunk(first, last);
+        fft_inner_four_step_batch(chunk, domain, domain.root, domain.get_round_roots(), domain.generator);
+    }
+}
+
 template <typename Fr>
 void coset_fft(Fr* coeffs,
                const EvaluationDomain<Fr>& domain,
@@ -626,7 +941,8 @@ void coset_fft(Fr* coeffs,
 
     // Fr work_root = domain.generator.sqr();
     // work_root = domain.generator.sqr();
-    Fr* scratch_space = get_scratch_space<Fr>(domain.size * domain_extension);
+    ScratchSpace<Fr> scratch(domain.size * domain_extension);
+    Fr* scratch_space = scratch.get();
 
     // Fr* temp_memory = static_cast<Fr*>(aligned_alloc(64, sizeof(Fr) * domain.size *
     // domain_extension));
@@ -649,19 +965,17 @@ void coset_fft(Fr* coeffs,
     }
 
     if (domain_extension == 4) {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
-            const size_t start = j * domain.thread_size;
-            const size_t end = (j + 1) * domain.thread_size;
-            for (size_t i = start; i < end; ++i) {
-                Fr::__copy(scratch_space[i], coeffs[(i << 2UL)]);
-                Fr::__copy(scratch_space[i + (1UL << domain.log2_size)], coeffs[(i << 2UL) + 1UL]);
-                Fr::__copy(scratch_space[i + (2UL << domain.log2_size)], coeffs[(i << 2UL) + 2UL]);
-                Fr::__copy(scratch_space[i + (3UL << domain.log2_size)], coeffs[(i << 2UL) + 3UL]);
-            }
-        }
+        parallel_for(
+            domain.size,
+            [&](const size_t start, const size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    Fr::__copy(scratch_space[i], coeffs[(i << 2UL)]);
+                    Fr::__copy(scratch_space[i + (1UL << domain.log2_size)], coeffs[(i << 2UL) + 1UL]);
+                    Fr::__copy(scratch_space[i + (2UL << domain.log2_size)], coeffs[(i << 2UL) + 2UL]);
+                    Fr::__copy(scratch_space[i + (3UL << domain.log2_size)], coeffs[(i << 2UL) + 3UL]);
+                }
+            },
+            MIN_GRAIN_SIZE);
         for (size_t i = 0; i < domain.size; ++i) {
             for (size_t j = 0; j < domain_extension; ++j) {
                 Fr::__copy(scratch_space[i + (j << domain.log2_size)], coeffs[(i << log2_domain_extension) + j]);
@@ -692,7 +1006,11 @@ void coset_fft_with_generator_shift(Fr* coeffs, const EvaluationDomain<Fr>& doma
 
 template <typename Fr> void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    if (use_four_step_fft(domain, 1, 1)) {
+        fft_inner_four_step({ coeffs }, { coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    } else {
+        fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    }
     Fr T0 = domain.domain_inverse * value;
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= T0;
@@ -747,34 +1065,27 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
-#ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
-    size_t range_per_thread = n / num_threads;
-    size_t leftovers = n - (range_per_thread * num_threads);
-    Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
-        Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
-        size_t offset = j * range_per_thread;
-        evaluations[j] = Fr::zero();
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            Fr work_var = z_acc * coeffs[i];
-            evaluations[j] += work_var;
-            z_acc *= z;
-        }
-    }
+    // one partial sum per range: ranges are at least MIN_GRAIN_SIZE long, so there are at most as many of them
+    const size_t num_ranges = (n + MIN_GRAIN_SIZE - 1) / MIN_GRAIN_SIZE;
+    std::vector<Fr> evaluations(num_ranges, Fr::zero());
+    parallel_for(
+        n,
+        [&](const size_t start, const size_t end) {
+            Fr z_acc = z.pow(static_cast<uint64_t>(start));
+            Fr evaluation = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                Fr work_var = z_acc * coeffs[i];
+                evaluation += work_var;
+                z_acc *= z;
+            }
+            evaluations[start / MIN_GRAIN_SIZE] = evaluation;
+        },
+        MIN_GRAIN_SIZE);
 
     Fr r = Fr::zero();
-    for (size_t j = 0; j < num_threads; ++j) {
-        r += evaluations[j];
+    for (const Fr& evaluation : evaluations) {
+        r += evaluation;
     }
-    delete[] evaluations;
     return r;
 }
 
@@ -784,34 +1095,27 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     const size_t poly_size = large_n / num_polys;
     ASSERT(is_power_of_two(poly_size));
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-#ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
-    size_t range_per_thread = large_n / num_threads;
-    size_t leftovers = large_n - (range_per_thread * num_threads);
-    Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
-        Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
-        size_t offset = j * range_per_thread;
-        evaluations[j] = Fr::zero();
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            Fr work_var = z_acc * coeffs[i >> log2_poly_size][i & (poly_size - 1)];
-            evaluations[j] += work_var;
-            z_acc *= z;
-        }
-    }
+    // one partial sum per range: ranges are at least MIN_GRAIN_SIZE long, so there are at most as many of them
+    const size_t num_ranges = (large_n + MIN_GRAIN_SIZE - 1) / MIN_GRAIN_SIZE;
+    std::vector<Fr> evaluations(num_ranges, Fr::zero());
+    parallel_for(
+        large_n,
+        [&](const size_t start, const size_t end) {
+            Fr z_acc = z.pow(static_cast<uint64_t>(start));
+            Fr evaluation = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                Fr work_var = z_acc * coeffs[i >> log2_poly_size][i & (poly_size - 1)];
+                evaluation += work_var;
+                z_acc *= z;
+            }
+            evaluations[start / MIN_GRAIN_SIZE] = evaluation;
+        },
+        MIN_GRAIN_SIZE);
 
     Fr r = Fr::zero();
-    for (size_t j = 0; j < num_threads; ++j) {
-        r += evaluations[j];
+    for (const Fr& evaluation : evaluations) {
+        r += evaluation;
     }
-    delete[] evaluations;
     return r;
 }
 
@@ -821,6 +1125,7 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
  * @param l_1_coefficients
  * @param src_domain
  * @param target_domain
+ * @param generator_shift
  * @details Let the size of the target domain be k*n, where k is a power of 2.
  * Evaluate L_1(X) = (X^{n} - 1 / (X - 1)) * (1 / n) at the k*n points X_i = w'^i.g,
  * i = 0, 1,..., k*n-1, where w' is the target domain (kn'th) root of unity, and g is the
@@ -848,28 +1153,32 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
  * We can consider `l_1_coefficients` to be a k*n-sized vector of the evaluations of L_1(X),
  * for all X = k*n'th roots of unity. To compute the vector for the k*n-fft transform of
  * L_i(X), we perform a (k*i)-left-shift of this vector.
+ *
+ * Note 3: With a `generator_shift` s, the points are X_i = w'^i.g.s instead. This evaluates L_1(X) on a single block
+ * of a larger coset, e.g. the points w''^{j + 2i}.g of the 4n coset (s = w''^j, w'' the 4n'th root of unity) when the
+ * target domain has size 2n.
  */
 template <typename Fr>
 void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
                                      const EvaluationDomain<Fr>& src_domain,
-                                     const EvaluationDomain<Fr>& target_domain)
+                                     const EvaluationDomain<Fr>& target_domain,
+                                     const Fr& generator_shift)
 {
     // Step 1: Compute the 1/denominator for each evaluation: 1 / (X_i - 1)
     Fr multiplicand = target_domain.root; // kn'th root of unity w'
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
     // First compute X_i - 1, i = 0,...,kn-1
-    for (size_t j = 0; j < target_domain.num_threads; ++j) {
-        const Fr root_shift = multiplicand.pow(static_cast<uint64_t>(j * target_domain.thread_size));
-        Fr work_root = src_domain.generator * root_shift; // g.(w')^{j*thread_size}
-        size_t offset = j * target_domain.thread_size;
-        for (size_t i = offset; i < offset + target_domain.thread_size; ++i) {
-            l_1_coefficients[i] = work_root - Fr::one(); // (w')^{j*thread_size + i}.g - 1
-            work_root *= multiplicand;                   // (w')^{j*thread_size + i + 1}
-        }
-    }
+    parallel_for(
+        target_domain.size,
+        [&](const size_t start, const size_t end) {
+            const Fr root_shift = multiplicand.pow(static_cast<uint64_t>(start));
+            Fr work_root = src_domain.generator * generator_shift * root_shift; // g.s.(w')^{start}
+            for (size_t i = start; i < end; ++i) {
+                l_1_coefficients[i] = work_root - Fr::one(); // (w')^{i}.g - 1
+                work_root *= multiplicand;                   // (w')^{i + 1}
+            }
+        },
+        MIN_GRAIN_SIZE);
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
     Fr::batch_invert(l_1_coefficients, target_domain.size);
@@ -882,23 +1191,24 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     Fr* subgroup_roots = new Fr[subgroup_size];
     compute_multiplicative_subgroup(log2_subgroup_size, src_domain, &subgroup_roots[0]);
 
-    // Subtract 1 and divide by n to get the k elements (1/n)*(X_i^n - 1)
+    // Subtract 1 and divide by n to get the k elements (1/n)*(X_i^n - 1). The cofactor of a shifted coset is (g.s)^n
+    const Fr shift_power = generator_shift.pow(static_cast<uint64_t>(src_domain.size));
     for (size_t i = 0; i < subgroup_size; ++i) {
+        subgroup_roots[i] *= shift_power;
         subgroup_roots[i] -= Fr::one();
         subgroup_roots[i] *= src_domain.domain_inverse;
     }
     // Step 3: Construct L_1(X_i) by multiplying the 1/denominator evaluations in
     // l_1_coefficients by the numerator evaluations in subgroup_roots
     size_t subgroup_mask = subgroup_size - 1;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < target_domain.num_threads; ++i) {
-        for (size_t j = 0; j < target_domain.thread_size; ++j) {
-            size_t eval_idx = i * target_domain.thread_size + j;
-            l_1_coefficients[eval_idx] *= subgroup_roots[eval_idx & subgroup_mask];
-        }
-    }
+    parallel_for(
+        target_domain.size,
+        [&](const size_t start, const size_t end) {
+            for (size_t eval_idx = start; eval_idx < end; ++eval_idx) {
+                l_1_coefficients[eval_idx] *= subgroup_roots[eval_idx & subgroup_mask];
+            }
+        },
+        MIN_GRAIN_SIZE);
     delete[] subgroup_roots;
 }
 
@@ -973,30 +1283,14 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
     }
     // Compute first value of g.w_i
 
-    // Step 5: iterate over point evaluations, scaling each one by the inverse of the vanishing polynomial
-    if (subgroup_size >= target_domain.thread_size) {
-        Fr work_root = src_domain.generator;
-        for (size_t i = 0; i < target_domain.size; i += subgroup_size) {
-            for (size_t j = 0; j < subgroup_size; ++j) {
-                size_t poly_idx = (i + j) >> log2_poly_size;
-                size_t elem_idx = (i + j) & poly_mask;
-                coeffs[poly_idx][elem_idx] *= subgroup_roots[j];
-
-                for (size_t k = 0; k < num_roots_cut_out_of_vanishing_polynomial; ++k) {
-                    coeffs[poly_idx][elem_idx] *= work_root + numerator_constants[k];
-                }
-                work_root *= target_domain.root;
-            }
-        }
-    } else {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t k = 0; k < target_domain.num_threads; ++k) {
-            size_t offset = k * target_domain.thread_size;
-            const Fr root_shift = target_domain.root.pow(static_cast<uint64_t>(offset));
+    // Step 5: iterate over point evaluations, scaling each one by the inverse of the vanishing polynomial. Ranges are
+    // whole subgroups
+    parallel_for(
+        target_domain.size,
+        [&](const size_t start, const size_t end) {
+            const Fr root_shift = target_domain.root.pow(static_cast<uint64_t>(start));
             Fr work_root = src_domain.generator * root_shift;
-            for (size_t i = offset; i < offset + target_domain.thread_size; i += subgroup_size) {
+            for (size_t i = start; i < end; i += subgroup_size) {
                 for (size_t j = 0; j < subgroup_size; ++j) {
                     size_t poly_idx = (i + j) >> log2_poly_size;
                     size_t elem_idx = (i + j) & poly_mask;
@@ -1009,8 +1303,8 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                     work_root *= target_domain.root;
                 }
             }
-        }
-    }
+        },
+        std::max(subgroup_size, MIN_GRAIN_SIZE));
     delete[] subgroup_roots;
 }
 
@@ -1211,7 +1505,8 @@ template <typename Fr> Fr compute_sum(const Fr* src, const size_t n)
 // This function computes the polynomial (x - a)(x - b)(x - c)... given n distinct roots (a, b, c, ...).
 template <typename Fr> void compute_linear_polynomial_product(const Fr* roots, Fr* dest, const size_t n)
 {
-    Fr* scratch_space = get_scratch_space<Fr>(n);
+    ScratchSpace<Fr> scratch(n);
+    Fr* scratch_space = scratch.get();
     memcpy((void*)scratch_space, (void*)roots, n * sizeof(Fr));
 
     dest[n] = 1;
@@ -1368,6 +1663,8 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_four_step<fr>(
+    const std::vector<fr*>&, const std::vector<fr*>&, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -1375,6 +1672,8 @@ template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&)
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
 template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
@@ -1391,7 +1690,10 @@ template void partial_fft<fr>(fr*, const EvaluationDomain<fr>&, fr, bool);
 template void add<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void sub<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void mul<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
-template void compute_lagrange_polynomial_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+template void compute_lagrange_polynomial_fft<fr>(fr*,
+                                                  const EvaluationDomain<fr>&,
+                                                  const EvaluationDomain<fr>&,
+                                                  const fr&);
 template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                         const EvaluationDomain<fr>&,
                                                         const EvaluationDomain<fr>&,
@@ -1419,6 +1721,11 @@ template void fft_inner_parallel<grumpkin::fr>(std::vector<grumpkin::fr*>,
                                                const EvaluationDomain<grumpkin::fr>&,
                                                const grumpkin::fr&,
                                                const std::vector<grumpkin::fr*>&);
+template void fft_inner_four_step<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                                const std::vector<grumpkin::fr*>&,
+                                                const EvaluationDomain<grumpkin::fr>&,
+                                                const grumpkin::fr&,
+                                                const std::vector<grumpkin::fr*>&);
 template void fft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void fft<grumpkin::fr>(grumpkin::fr*, grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void fft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
@@ -1428,6 +1735,9 @@ template void fft_with_constant<grumpkin::fr>(grumpkin::fr*,
 template void coset_fft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void coset_fft<grumpkin::fr>(grumpkin::fr*, grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void coset_fft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+template void fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+template void coset_fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                             const EvaluationDomain<grumpkin::fr>&);
 template void coset_fft<grumpkin::fr>(grumpkin::fr*,
                                       const EvaluationDomain<grumpkin::fr>&,
                                       const EvaluationDomain<grumpkin::fr>&,
@@ -1468,7 +1778,8 @@ template void mul<grumpkin::fr>(const grumpkin::fr*,
                                 const EvaluationDomain<grumpkin::fr>&);
 template void compute_lagrange_polynomial_fft<grumpkin::fr>(grumpkin::fr*,
                                                             const EvaluationDomain<grumpkin::fr>&,
-                                                            const EvaluationDomain<grumpkin::fr>&);
+                                                            const EvaluationDomain<grumpkin::fr>&,
+                                                            const grumpkin::fr&);
 template void divide_by_pseudo_vanishing_polynomial<grumpkin::fr>(std::vector<grumpkin::fr*>,
                                                                   const EvaluationDomain<grumpkin::fr>&,
                                                                   const EvaluationDomain<grumpkin::fr>&,
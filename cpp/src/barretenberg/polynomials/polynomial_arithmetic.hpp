@@ -29,6 +29,13 @@ template <typename Fr>
 void copy_polynomial(const Fr* src, Fr* dest, size_t num_src_coefficients, size_t num_target_coefficients);
 
 //  2. Compute a lookup table of the roots of unity, and suffer through cache misses from nonlinear access patterns
+// `fft_inner_serial` and `fft_inner_parallel` run the rounds after the first in passes of up to `log2_radix` rounds,
+// i.e. with radix-2, radix-4 or radix-8 butterflies. Each pass streams the domain through memory once
+constexpr size_t MAX_FFT_LOG2_RADIX = 3;
+constexpr size_t DEFAULT_FFT_LOG2_RADIX = 2;
+void set_fft_log2_radix(size_t log2_radix);
+size_t get_fft_log2_radix();
+
 template <typename Fr>
 void fft_inner_serial(std::vector<Fr*> coeffs, const size_t domain_size, const std::vector<Fr*>& root_table);
 template <typename Fr>
@@ -37,6 +44,16 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
 
+// `fft`, `ifft` and the coset FFTs use `fft_inner_four_step` for domains of at least 2^FOUR_STEP_FFT_MIN_LOG_SIZE
+// elements, whose radix-2 rounds would each stream the whole domain through the caches
+constexpr size_t FOUR_STEP_FFT_MIN_LOG_SIZE = 16;
+template <typename Fr>
+void fft_inner_four_step(const std::vector<Fr*>& coeffs,
+                         const std::vector<Fr*>& target,
+                         const EvaluationDomain<Fr>& domain,
+                         const Fr& root,
+                         const std::vector<Fr*>& root_table);
+
 template <typename Fr> void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
@@ -45,6 +62,14 @@ template <typename Fr> void fft_with_constant(Fr* coeffs, const EvaluationDomain
 template <typename Fr> void coset_fft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void coset_fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
+
+// FFT (coset FFT) of several polynomials over the same domain, in place. Unlike the `std::vector<Fr*>` overloads of
+// `fft` and `coset_fft`, every pointer is a whole polynomial rather than a part of one split polynomial.
+// On domains that use the four-step FFT, up to `BATCH_FFT_MAX_POLYS` polynomials are transformed in lockstep and share
+// each twiddle factor; this allocates a temporary copy of those polynomials.
+constexpr size_t BATCH_FFT_MAX_POLYS = 4;
+template <typename Fr> void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
 template <typename Fr>
 void coset_fft(Fr* coeffs,
                const EvaluationDomain<Fr>& small_domain,
@@ -94,10 +119,12 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 // We can consider `l_1_coefficients` to be a k*n-sized vector of the evaluations of L_1(X),
 // for all X = k*n'th roots of unity.
 // To compute the vector for the k*n-fft transform of L_i(X), we perform a (k*i)-left-shift of this vector
+// A `generator_shift` s evaluates L_1(X) on the coset g.s.<w'> instead
 template <typename Fr>
 void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
                                      const EvaluationDomain<Fr>& src_domain,
-                                     const EvaluationDomain<Fr>& target_domain);
+                                     const EvaluationDomain<Fr>& target_domain,
+                                     const Fr& generator_shift = Fr::one());
 
 template <typename Fr>
 void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
@@ -346,6 +373,8 @@ extern template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, con
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+extern template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
 extern template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
@@ -363,7 +392,10 @@ extern template void partial_fft<fr>(fr*, const EvaluationDomain<fr>&, fr, bool)
 extern template void add<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 extern template void sub<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 extern template void mul<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
-extern template void compute_lagrange_polynomial_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+extern template void compute_lagrange_polynomial_fft<fr>(fr*,
+                                                         const EvaluationDomain<fr>&,
+                                                         const EvaluationDomain<fr>&,
+                                                         const fr&);
 extern template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                                const EvaluationDomain<fr>&,
                                                                const EvaluationDomain<fr>&,
@@ -407,6 +439,10 @@ extern template void fft_with_constant<grumpkin::fr>(grumpkin::fr*,
 extern template void coset_fft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 extern template void coset_fft<grumpkin::fr>(grumpkin::fr*, grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 extern template void coset_fft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+extern template void fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                              const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                                    const EvaluationDomain<grumpkin::fr>&);
 extern template void coset_fft<grumpkin::fr>(grumpkin::fr*,
                                              const EvaluationDomain<grumpkin::fr>&,
                                              const EvaluationDomain<grumpkin::fr>&,
@@ -452,7 +488,8 @@ extern template void mul<grumpkin::fr>(const grumpkin::fr*,
                                        const EvaluationDomain<grumpkin::fr>&);
 extern template void compute_lagrange_polynomial_fft<grumpkin::fr>(grumpkin::fr*,
                                                                    const EvaluationDomain<grumpkin::fr>&,
-                                                                   const EvaluationDomain<grumpkin::fr>&);
+                                                                   const EvaluationDomain<grumpkin::fr>&,
+                                                                   const grumpkin::fr&);
 extern template void divide_by_pseudo_vanishing_polynomial<grumpkin::fr>(std::vector<grumpkin::fr*>,
                                                                          const EvaluationDomain<grumpkin::fr>&,
                                                                          const EvaluationDomain<grumpkin::fr>&,
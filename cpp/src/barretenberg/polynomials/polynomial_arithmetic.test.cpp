@@ -1,8 +1,11 @@
 #include "polynomial_arithmetic.hpp"
 #include <algorithm>
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include <chrono>
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <thread>
 #include <utility>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -203,6 +206,221 @@ TEST(polynomials, split_polynomial_fft_ifft_consistency)
     }
 }
 
+TEST(polynomials, four_step_fft_consistency)
+{
+    // large enough for `fft` and `ifft` to use the four-step FFT; odd log size, so that n1 != n2
+    constexpr size_t n = 1UL << (polynomial_arithmetic::FOUR_STEP_FFT_MIN_LOG_SIZE + 1);
+    constexpr size_t num_poly = 4;
+    std::vector<fr> coefficients(n);
+    for (size_t i = 0; i < n; ++i) {
+        coefficients[i] = fr::random_element();
+    }
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<fr> expected(coefficients);
+    polynomial_arithmetic::fft_inner_parallel({ expected.data() }, domain, domain.root, domain.get_round_roots());
+
+    // in place
+    std::vector<fr> result(coefficients);
+    polynomial_arithmetic::fft(result.data(), domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], expected[i]);
+    }
+    polynomial_arithmetic::ifft(result.data(), domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], coefficients[i]);
+    }
+
+    // out of place
+    std::vector<fr> target(n);
+    polynomial_arithmetic::fft(coefficients.data(), target.data(), domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(target[i], expected[i]);
+    }
+
+    // split into several polynomials
+    std::vector<fr> split(coefficients);
+    std::vector<fr*> split_polys;
+    for (size_t j = 0; j < num_poly; ++j) {
+        split_polys.push_back(&split[j * (n / num_poly)]);
+    }
+    polynomial_arithmetic::fft(split_polys, domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(split[i], expected[i]);
+    }
+}
+
+TEST(polynomials, batch_fft_consistency)
+{
+    // large enough for the batched four-step FFT; 5 polynomials are transformed as a batch of 4 and a batch of 1
+    constexpr size_t n = 1UL << (polynomial_arithmetic::FOUR_STEP_FFT_MIN_LOG_SIZE + 1);
+    constexpr size_t num_polys = 5;
+    std::vector<fr> base(n);
+    for (size_t i = 0; i < n; ++i) {
+        base[i] = fr::random_element();
+    }
+    std::vector<std::vector<fr>> polys(num_polys, std::vector<fr>(n));
+    for (size_t p = 0; p < num_polys; ++p) {
+        for (size_t i = 0; i < n; ++i) {
+            polys[p][i] = base[i] * base[(i + p) % n];
+        }
+    }
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    for (const size_t batch_size : { 3UL, num_polys }) {
+        const auto batch_end = polys.begin() + static_cast<std::ptrdiff_t>(batch_size);
+        std::vector<std::vector<fr>> fft_results(polys.begin(), batch_end);
+        std::vector<std::vector<fr>> coset_fft_results(fft_results);
+        std::vector<fr*> fft_pointers;
+        std::vector<fr*> coset_fft_pointers;
+        for (size_t p = 0; p < batch_size; ++p) {
+            fft_pointers.push_back(fft_results[p].data());
+            coset_fft_pointers.push_back(coset_fft_results[p].data());
+        }
+        polynomial_arithmetic::fft_batch(fft_pointers, domain);
+        polynomial_arithmetic::coset_fft_batch(coset_fft_pointers, domain);
+
+        for (size_t p = 0; p < batch_size; ++p) {
+            std::vector<fr> expected(polys[p]);
+            polynomial_arithmetic::fft(expected.data(), domain);
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(fft_results[p][i], expected[i]);
+            }
+            expected = polys[p];
+            polynomial_arithmetic::coset_fft(expected.data(), domain);
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(coset_fft_results[p][i], expected[i]);
+            }
+        }
+    }
+}
+
+TEST(polynomials, fft_radix_consistency)
+{
+    // 2^11 leaves 10 rounds after the first: a whole number of radix-2 passes but not of radix-4 or radix-8 ones
+    constexpr size_t n = 1UL << 11;
+    constexpr size_t num_poly = 4;
+    std::vector<fr> coefficients(n);
+    for (size_t i = 0; i < n; ++i) {
+        coefficients[i] = fr::random_element();
+    }
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<fr> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] = polynomial_arithmetic::evaluate(coefficients.data(), domain.root.pow(i), n);
+    }
+
+    const size_t default_log2_radix = polynomial_arithmetic::get_fft_log2_radix();
+    for (size_t log2_radix = 1; log2_radix <= polynomial_arithmetic::MAX_FFT_LOG2_RADIX; ++log2_radix) {
+        polynomial_arithmetic::set_fft_log2_radix(log2_radix);
+
+        std::vector<fr> result(coefficients);
+        polynomial_arithmetic::fft_inner_parallel({ result.data() }, domain, domain.root, domain.get_round_roots());
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected[i]);
+        }
+
+        std::vector<fr> target(n);
+        polynomial_arithmetic::fft(coefficients.data(), target.data(), domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(target[i], expected[i]);
+        }
+
+        std::vector<fr> split(coefficients);
+        std::vector<fr*> split_polys;
+        for (size_t j = 0; j < num_poly; ++j) {
+            split_polys.push_back(&split[j * (n / num_poly)]);
+        }
+        polynomial_arithmetic::fft_inner_parallel(split_polys, domain, domain.root, domain.get_round_roots());
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(split[i], expected[i]);
+        }
+
+        std::vector<fr> serial(coefficients);
+        polynomial_arithmetic::fft_inner_serial({ serial.data() }, n, domain.get_round_roots());
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(serial[i], expected[i]);
+        }
+    }
+    polynomial_arithmetic::set_fft_log2_radix(default_log2_radix);
+}
+
+#ifndef NO_MULTITHREADING
+TEST(polynomials, parallel_for_concurrent_callers)
+{
+    // threads outside the pool each push onto a queue of their own, and go to sleep in the middle of their loops while
+    // the other threads run their ranges
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_loops = 8;
+    constexpr size_t num_iterations = 1UL << 12;
+    const size_t default_num_threads = get_num_threads();
+    set_num_threads(3);
+    std::vector<std::vector<size_t>> counts(num_callers, std::vector<size_t>(num_iterations, 0));
+    std::vector<std::thread> callers;
+    for (size_t c = 0; c < num_callers; ++c) {
+        callers.emplace_back([&counts, c]() {
+            for (size_t j = 0; j < num_loops; ++j) {
+                parallel_for(num_iterations, [&](const size_t start, const size_t end) {
+                    for (size_t i = start; i < end; ++i) {
+                        ++counts[c][i];
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                });
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    set_num_threads(default_num_threads);
+    for (const auto& caller_counts : counts) {
+        for (const size_t count : caller_counts) {
+            EXPECT_EQ(count, num_loops);
+        }
+    }
+}
+#endif
+
+TEST(polynomials, fft_thread_count_consistency)
+{
+    // the results must not depend on how the loops are split between threads; 3 threads split nothing evenly
+    constexpr size_t n = 1UL << (polynomial_arithmetic::FOUR_STEP_FFT_MIN_LOG_SIZE + 1);
+    std::vector<fr> coefficients(n);
+    for (size_t i = 0; i < n; ++i) {
+        coefficients[i] = fr::random_element();
+    }
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+    const fr z = fr::random_element();
+
+    std::vector<fr> expected_fft(coefficients);
+    std::vector<fr> expected_coset_fft(coefficients);
+    polynomial_arithmetic::fft(expected_fft.data(), domain);
+    polynomial_arithmetic::coset_fft(expected_coset_fft.data(), domain);
+    const fr expected_evaluation = polynomial_arithmetic::evaluate(coefficients.data(), z, n);
+
+    const size_t default_num_threads = get_num_threads();
+    for (const size_t num_threads : { 1UL, 3UL }) {
+        set_num_threads(num_threads);
+        std::vector<fr> result(coefficients);
+        polynomial_arithmetic::fft(result.data(), domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected_fft[i]);
+        }
+        result = coefficients;
+        polynomial_arithmetic::coset_fft(result.data(), domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected_coset_fft[i]);
+        }
+        EXPECT_EQ(polynomial_arithmetic::evaluate(coefficients.data(), z, n), expected_evaluation);
+    }
+    set_num_threads(default_num_threads);
+}
+
 TEST(polynomials, fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1194,3 +1412,70 @@ TEST(polynomials, default_construct_then_assign)
     }
     EXPECT_EQ(poly.size(), interesting_poly.size());
 }
+
+TEST(polynomials, arena_reuses_returned_blocks)
+{
+    // A size no other test uses, so that the second polynomial can only be served by the first one's block
+    const size_t num_coeffs = (1UL << 13) + 7;
+    auto& arena = get_polynomial_arena();
+    {
+        polynomial poly(num_coeffs);
+        poly[0] = fr::random_element();
+    }
+    polynomial_arena_stats before = arena.get_stats();
+    {
+        polynomial poly(num_coeffs);
+        // the recycled block is zeroed like a new one
+        EXPECT_EQ(poly[0], fr::zero());
+        EXPECT_GE(arena.get_stats().bytes_live, before.bytes_live + num_coeffs * sizeof(fr));
+    }
+    polynomial_arena_stats after = arena.get_stats();
+    EXPECT_EQ(after.num_hits, before.num_hits + 1);
+    EXPECT_EQ(after.num_misses, before.num_misses);
+    EXPECT_EQ(after.bytes_live, before.bytes_live);
+}
+
+TEST(polynomials, arena_releases_other_size_classes)
+{
+    PolynomialArena arena;
+    const size_t small_block = 1UL << 20;
+    const size_t large_block = 1UL << 21;
+
+    void* a = arena.allocate(small_block);
+    void* b = arena.allocate(small_block);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0UL);
+    arena.deallocate(a);
+    arena.deallocate(b);
+    EXPECT_GE(arena.get_stats().bytes_cached, 2 * small_block);
+
+    // Neither cached block fits, so both are released to make room for the new one
+    void* c = arena.allocate(large_block);
+    polynomial_arena_stats stats = arena.get_stats();
+    EXPECT_EQ(stats.bytes_cached, 0UL);
+    EXPECT_EQ(stats.num_misses, 3UL);
+    EXPECT_GE(stats.peak_bytes_live, 2 * small_block);
+
+    arena.deallocate(c);
+    void* d = arena.allocate(large_block);
+    EXPECT_EQ(d, c);
+    EXPECT_EQ(arena.get_stats().num_hits, 1UL);
+    arena.deallocate(d);
+
+    arena.trim();
+    EXPECT_EQ(arena.get_stats().bytes_cached, 0UL);
+    EXPECT_EQ(arena.get_stats().bytes_live, 0UL);
+}
+
+TEST(polynomials, arena_trim_releases_thread_cache)
+{
+    // A size no other test uses. The returned block lands in this thread's cache, or in the free lists if that is full;
+    // either way trim releases it, so the next allocation of its size needs new memory
+    const size_t num_bytes = (1UL << 18) + 64;
+    auto& arena = get_polynomial_arena();
+    arena.deallocate(arena.allocate(num_bytes));
+    arena.trim();
+    polynomial_arena_stats before = arena.get_stats();
+    void* block = arena.allocate(num_bytes);
+    EXPECT_EQ(arena.get_stats().num_misses, before.num_misses + 1);
+    arena.deallocate(block);
+}
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/ecc/curves/bn254/fq.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
@@ -208,43 +209,102 @@ void new_plonk_scalar_multiplications_bench(State& state) noexcept
 }
 BENCHMARK(new_plonk_scalar_multiplications_bench);
 
+// The FFT benchmarks take the log2 of the butterfly radix as their second argument (see `set_fft_log2_radix`)
 void coset_fft_bench_parallel(State& state) noexcept
 {
+    polynomial_arithmetic::set_fft_log2_radix(static_cast<size_t>(state.range(1)));
     for (auto _ : state) {
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::coset_fft(globals.data, evaluation_domains[idx]);
     }
 }
-BENCHMARK(coset_fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4);
+BENCHMARK(coset_fft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Ranges({ { START * 4, MAX_GATES * 4 }, { 1, polynomial_arithmetic::MAX_FFT_LOG2_RADIX } });
 
 void alternate_coset_fft_bench_parallel(State& state) noexcept
 {
+    polynomial_arithmetic::set_fft_log2_radix(static_cast<size_t>(state.range(1)));
     for (auto _ : state) {
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::coset_fft(
             globals.data, evaluation_domains[idx - 2], evaluation_domains[idx - 2], 4);
     }
 }
-BENCHMARK(alternate_coset_fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4);
+BENCHMARK(alternate_coset_fft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Ranges({ { START * 4, MAX_GATES * 4 }, { 1, polynomial_arithmetic::MAX_FFT_LOG2_RADIX } });
 
+// domains of 2^FOUR_STEP_FFT_MIN_LOG_SIZE or more use the four-step FFT, whose sub-FFTs are always radix-2
 void fft_bench_parallel(State& state) noexcept
 {
+    polynomial_arithmetic::set_fft_log2_radix(static_cast<size_t>(state.range(1)));
     for (auto _ : state) {
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::fft(globals.data, evaluation_domains[idx]);
     }
 }
-BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4);
+BENCHMARK(fft_bench_parallel)
+    ->RangeMultiplier(2)
+    ->Ranges({ { START * 4, MAX_GATES * 4 }, { 1, polynomial_arithmetic::MAX_FFT_LOG2_RADIX } });
 
 void fft_bench_serial(State& state) noexcept
 {
+    polynomial_arithmetic::set_fft_log2_radix(static_cast<size_t>(state.range(1)));
     for (auto _ : state) {
         size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
         barretenberg::polynomial_arithmetic::fft_inner_serial(
             { globals.data }, evaluation_domains[idx].thread_size, evaluation_domains[idx].get_round_roots());
     }
 }
-BENCHMARK(fft_bench_serial)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4);
+BENCHMARK(fft_bench_serial)
+    ->RangeMultiplier(2)
+    ->Ranges({ { START * 4, MAX_GATES * 4 }, { 1, polynomial_arithmetic::MAX_FFT_LOG2_RADIX } });
+
+// The thread count benchmarks take the number of threads of the pool as their second argument, including counts that
+// are not powers of two. Counts above the number of cores oversubscribe them
+void fft_bench_threads(State& state) noexcept
+{
+    const size_t pool_num_threads = get_num_threads();
+    set_num_threads(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        barretenberg::polynomial_arithmetic::fft(globals.data, evaluation_domains[idx]);
+    }
+    set_num_threads(pool_num_threads);
+}
+BENCHMARK(fft_bench_threads)
+    ->ArgsProduct({ { START * 64, MAX_GATES * 4 }, { 24, 48, 96 } })
+    ->Unit(benchmark::kMillisecond);
+
+void coset_fft_bench_threads(State& state) noexcept
+{
+    const size_t pool_num_threads = get_num_threads();
+    set_num_threads(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        barretenberg::polynomial_arithmetic::coset_fft(globals.data, evaluation_domains[idx]);
+    }
+    set_num_threads(pool_num_threads);
+}
+BENCHMARK(coset_fft_bench_threads)
+    ->ArgsProduct({ { START * 64, MAX_GATES * 4 }, { 24, 48, 96 } })
+    ->Unit(benchmark::kMillisecond);
+
+void pippenger_bench_threads(State& state) noexcept
+{
+    const size_t pool_num_threads = get_num_threads();
+    set_num_threads(static_cast<size_t>(state.range(1)));
+    const size_t num_points = static_cast<size_t>(state.range(0));
+    scalar_multiplication::pippenger_runtime_state run_state(num_points);
+    for (auto _ : state) {
+        scalar_multiplication::pippenger(&globals.scalars[0], &globals.monomials[0], num_points, run_state);
+    }
+    set_num_threads(pool_num_threads);
+}
+BENCHMARK(pippenger_bench_threads)
+    ->ArgsProduct({ { START * 16, MAX_GATES }, { 24, 48, 96 } })
+    ->Unit(benchmark::kMillisecond);
 
 void pairing_bench(State& state) noexcept
 {
@@ -0,0 +1,126 @@
+#include "pairing_accumulator.hpp"
+#include "barretenberg/ecc/curves/bn254/fq12.hpp"
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_state_pool.hpp"
+
+#include <map>
+
+using namespace barretenberg;
+
+namespace bonk {
+
+void PairingAccumulator::add_claim(const g1::affine_element& lhs, const g1::affine_element& rhs)
+{
+    PairingClaim claim;
+    claim.add_lhs_term(fr::one(), lhs);
+    claim.add_rhs_term(fr::one(), rhs);
+    add_claim(std::move(claim));
+}
+
+bool PairingAccumulator::verify() const
+{
+    return verify(0, claims_.size());
+}
+
+std::vector<size_t> PairingAccumulator::get_failing_claims() const
+{
+    // Bisect: a range that holds is cleared with one check, so isolating a few bad claims in a large batch costs a
+    // number of batched checks logarithmic in its size, rather than one check per claim.
+    std::vector<size_t> failing_claims;
+    const auto find_failing_claims = [&](const size_t start, const size_t end, const auto& recurse) -> void {
+        if (start == end || verify(start, end)) {
+            return;
+        }
+        if (end - start == 1) {
+            failing_claims.push_back(start);
+            return;
+        }
+        const size_t mid = start + (end - start) / 2;
+        recurse(start, mid, recurse);
+        recurse(mid, end, recurse);
+    };
+    find_failing_claims(0, claims_.size(), find_failing_claims);
+    return failing_claims;
+}
+
+/**
+ * Check the claims in [start, end) with one MSM and one pairing.
+ *
+ * The terms of every claim are scaled by its weight (one for the first claim, whose weight does not matter, and random
+ * for the rest) and summed into two MSMs, P₀ and P₁, over the distinct points of the claims. Both are evaluated in one
+ * batched pippenger pass over the same point table.
+ */
+bool PairingAccumulator::verify(const size_t start, const size_t end) const
+{
+    std::vector<g1::affine_element> points;
+    std::vector<fr> lhs_scalars;
+    std::vector<fr> rhs_scalars;
+    // Points are keyed by their reduced coordinates: affine coordinates in Montgomery form need not be reduced.
+    std::map<std::pair<uint256_t, uint256_t>, size_t> point_indices;
+
+    const auto add_terms = [&](const fr& weight,
+                               const std::vector<fr>& scalars,
+                               const std::vector<g1::affine_element>& claim_points,
+                               std::vector<fr>& sums) {
+        for (size_t i = 0; i < claim_points.size(); ++i) {
+            const auto& point = claim_points[i];
+            if (point.is_point_at_infinity()) {
+                continue;
+            }
+            if (!point.on_curve()) {
+                return false;
+            }
+            const auto [it, inserted] =
+                point_indices.try_emplace({ uint256_t(point.x), uint256_t(point.y) }, points.size());
+            if (inserted) {
+                points.emplace_back(point);
+                lhs_scalars.emplace_back(fr::zero());
+                rhs_scalars.emplace_back(fr::zero());
+            }
+            sums[it->second] += weight * scalars[i];
+        }
+        return true;
+    };
+
+    for (size_t i = start; i < end; ++i) {
+        const auto& [claim, accepted] = claims_[i];
+        if (!accepted) {
+            return false;
+        }
+        const fr weight = (i == start) ? fr::one() : fr::random_element();
+        if (!add_terms(weight, claim.lhs_scalars, claim.lhs_points, lhs_scalars) ||
+            !add_terms(weight, claim.rhs_scalars, claim.rhs_points, rhs_scalars)) {
+            return false;
+        }
+    }
+
+    g1::element P[2];
+    P[0].self_set_infinity();
+    P[1].self_set_infinity();
+    const size_t num_points = points.size();
+    if (num_points > 0) {
+        points.resize(num_points * 2);
+        scalar_multiplication::generate_pippenger_point_table(&points[0], &points[0], num_points);
+        const auto results = scalar_multiplication::get_runtime_state_pool().pippenger_batch(
+            { &lhs_scalars[0], &rhs_scalars[0] }, &points[0], num_points);
+        P[0] = results[0];
+        P[1] = results[1];
+    }
+
+    // e(O, Q) = 1 for every Q, and e(P, Q) != 1 for P, Q != O of prime order, so a claim with a vanishing side holds
+    // iff its other side vanishes too. The pairing itself does not handle the point at infinity.
+    if (P[0].is_point_at_infinity() || P[1].is_point_at_infinity()) {
+        return P[0].is_point_at_infinity() && P[1].is_point_at_infinity();
+    }
+
+    g1::element::batch_normalize(P, 2);
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+    fq12 result = pairing::reduced_ate_pairing_batch_precomputed(P_affine, precomputed_g2_lines_, 2);
+
+    return (result == fq12::one());
+}
+
+} // namespace bonk
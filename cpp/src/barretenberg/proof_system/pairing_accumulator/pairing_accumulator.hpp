@@ -0,0 +1,84 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+
+#include <vector>
+
+namespace barretenberg::pairing {
+struct miller_lines;
+}
+
+namespace bonk {
+
+/**
+ * The pairing equation a KZG-based verifier reduces a proof to: e(P₀, [1]₂)⋅e(P₁, [x]₂) ≡ [1]ₜ, with P₀ and P₁ given
+ * as linear combinations of 𝔾₁ points rather than as the points themselves. Leaving them unevaluated lets a batch of
+ * claims be evaluated in one MSM, where the points the claims share (e.g. the verification key's commitments) are
+ * only added in once.
+ */
+struct PairingClaim {
+    std::vector<barretenberg::fr> lhs_scalars;
+    std::vector<barretenberg::g1::affine_element> lhs_points;
+    std::vector<barretenberg::fr> rhs_scalars;
+    std::vector<barretenberg::g1::affine_element> rhs_points;
+
+    void add_lhs_term(const barretenberg::fr& scalar, const barretenberg::g1::affine_element& point)
+    {
+        lhs_scalars.emplace_back(scalar);
+        lhs_points.emplace_back(point);
+    }
+    void add_rhs_term(const barretenberg::fr& scalar, const barretenberg::g1::affine_element& point)
+    {
+        rhs_scalars.emplace_back(scalar);
+        rhs_points.emplace_back(point);
+    }
+};
+
+/**
+ * Verifies many proofs' pairing claims with one MSM and one two-pair pairing.
+ *
+ * Each proof adds its claim (P₀ᵢ, P₁ᵢ), or a rejection if the verifier turned it down before it got that far (say, a
+ * failed sumcheck). verify() draws random weights ρᵢ and checks e(Σ ρᵢ⋅P₀ᵢ, [1]₂)⋅e(Σ ρᵢ⋅P₁ᵢ, [x]₂) ≡ [1]ₜ, which holds
+ * for every choice of weights if each claim holds, and with probability at most 1/|𝔽| if any one does not. The weights
+ * are drawn by the verifier when the batch is checked, so a prover cannot pick its proof to cancel against another.
+ *
+ * A batch that fails says only that some claim does. get_failing_claims() finds which by bisection: a half of the batch
+ * that holds is cleared with one batched check, so a few bad claims are found with a number of checks logarithmic in
+ * the size of the batch.
+ */
+class PairingAccumulator {
+  public:
+    /**
+     * @param precomputed_g2_lines the miller lines of [1]₂ and [x]₂ from the verifier's reference string, which must
+     * outlive the accumulator
+     */
+    PairingAccumulator(barretenberg::pairing::miller_lines const* precomputed_g2_lines)
+        : precomputed_g2_lines_(precomputed_g2_lines)
+    {}
+
+    void add_claim(PairingClaim claim) { claims_.emplace_back(std::move(claim), true); }
+    void add_claim(const barretenberg::g1::affine_element& lhs, const barretenberg::g1::affine_element& rhs);
+    void add_rejected_claim() { claims_.emplace_back(PairingClaim(), false); }
+
+    size_t size() const { return claims_.size(); }
+    void clear() { claims_.clear(); }
+
+    /**
+     * @return true iff every claim holds (up to the soundness error of the random weights). An empty batch holds.
+     */
+    bool verify() const;
+
+    /**
+     * @return the indices, in order of addition, of the claims that do not hold
+     */
+    std::vector<size_t> get_failing_claims() const;
+
+  private:
+    bool verify(const size_t start, const size_t end) const;
+
+    barretenberg::pairing::miller_lines const* precomputed_g2_lines_;
+    // a claim, and whether the verifier accepted it as far as the pairing
+    std::vector<std::pair<PairingClaim, bool>> claims_;
+};
+
+} // namespace bonk
@@ -4,6 +4,7 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 namespace bonk {
@@ -18,6 +19,8 @@ template <typename Fr> class PolynomialStore {
 
   private:
     std::unordered_map<std::string, Polynomial> polynomial_map;
+    // Files backing the polynomials registered with put_lazy; they are mapped into polynomial_map on first use
+    std::unordered_map<std::string, std::string> lazy_map;
 
   public:
     PolynomialStore() = default;
@@ -33,16 +36,112 @@ template <typename Fr> class PolynomialStore {
      * @param key string ID of the polynomial
      * @param value a Polynomial
      */
-    inline void put(std::string const& key, Polynomial&& value) { polynomial_map[key] = std::move(value); };
+    inline void put(std::string const& key, Polynomial&& value)
+    {
+        lazy_map.erase(key);
+        polynomial_map[key] = std::move(value);
+    };
+
+    /**
+     * @brief Register a polynomial that is mapped read-only from a file when it is first asked for
+     *
+     * @details Nothing is read here. The file has to be present, and unchanged, until the last time the polynomial is
+     * released and mapped again.
+     *
+     * @param key string ID of the polynomial
+     * @param filename file holding the coefficients of the polynomial (see Polynomial(std::string const&))
+     */
+    inline void put_lazy(std::string const& key, std::string const& filename)
+    {
+        polynomial_map.erase(key);
+        lazy_map[key] = filename;
+    };
+
+    /**
+     * @brief Create a store whose polynomials are read only views of this store's, for a reader that shares them
+     *
+     * @details Polynomials registered with put_lazy stay lazy in the new store, which maps them from the same files (and
+     * so shares their pages through the page cache). The polynomials of this store must be left unchanged while the new
+     * store lives.
+     *
+     * @param backing kept alive by the views; the owner of this store
+     */
+    PolynomialStore create_views(std::shared_ptr<void> const& backing) const
+    {
+        PolynomialStore views;
+        views.lazy_map = lazy_map;
+        for (const auto& [key, polynomial] : polynomial_map) {
+            if (!lazy_map.contains(key) && !polynomial.is_empty()) {
+                views.polynomial_map.emplace(
+                    key, Polynomial(backing, const_cast<Fr*>(polynomial.data()), polynomial.size()));
+            }
+        }
+        return views;
+    }
 
     /**
      * @brief Get a reference to a polynomial in the PolynomialStore; will throw exception if the
      * key does not exist in the map
      *
+     * @details A polynomial registered with put_lazy is mapped from its file here, the first time it is asked for (and
+     * the first time after a release). Mapping inserts into the store, so first accesses must not race with each other.
+     *
      * @param key string ID of the polynomial
      * @return Polynomial&; a reference to the polynomial associated with the given key
      */
-    inline Polynomial& get(std::string const& key) { return polynomial_map.at(key); };
+    inline Polynomial& get(std::string const& key)
+    {
+        auto entry = polynomial_map.find(key);
+        if (entry != polynomial_map.end()) {
+            return entry->second;
+        }
+        auto lazy_entry = lazy_map.find(key);
+        if (lazy_entry == lazy_map.end()) {
+            return polynomial_map.at(key);
+        }
+        return polynomial_map.emplace(key, Polynomial(lazy_entry->second)).first->second;
+    };
+
+    /**
+     * @brief Check whether the PolynomialStore holds a polynomial with the given key, mapped or not
+     *
+     * @param key string ID of the polynomial
+     */
+    inline bool contains(std::string const& key) const
+    {
+        return polynomial_map.contains(key) || lazy_map.contains(key);
+    };
+
+    /**
+     * @brief Check whether the polynomial with the given key is currently in memory (or mapped)
+     *
+     * @param key string ID of the polynomial
+     */
+    inline bool is_loaded(std::string const& key) const { return polynomial_map.contains(key); };
+
+    /**
+     * @brief Get the file a polynomial registered with put_lazy is mapped from; an empty string for any other polynomial
+     *
+     * @param key string ID of the polynomial
+     */
+    inline std::string get_lazy_filename(std::string const& key) const
+    {
+        auto lazy_entry = lazy_map.find(key);
+        return lazy_entry == lazy_map.end() ? std::string() : lazy_entry->second;
+    };
+
+    /**
+     * @brief Unmap a polynomial registered with put_lazy, dropping its pages. The next get maps it again. Does nothing
+     * for any other polynomial.
+     *
+     * @param key string ID of the polynomial
+     */
+    inline void release(std::string const& key)
+    {
+        if (lazy_map.contains(key)) {
+            polynomial_map.erase(key);
+        }
+    };
 
     /**
      * @brief Erase the polynomial with the given key from the map if it exists. (ASSERT that it does)
@@ -51,12 +150,13 @@ template <typename Fr> class PolynomialStore {
      */
     inline void remove(std::string const& key)
     {
-        ASSERT(polynomial_map.contains(key));
+        ASSERT(contains(key));
         polynomial_map.erase(key);
+        lazy_map.erase(key);
     };
 
     /**
-     * @brief Get the current size (bytes) of all polynomials in the PolynomialStore
+     * @brief Get the current size (bytes) of all polynomials in memory (or mapped) in the PolynomialStore
      *
      * @return size_t
      */
@@ -84,7 +184,7 @@ template <typename Fr> class PolynomialStore {
         info();
     }
 
-    // Allow for const range based for loop
+    // Allow for const range based for loop over the polynomials in memory (or mapped)
     typename std::unordered_map<std::string, Polynomial>::const_iterator begin() const
     {
         return polynomial_map.begin();
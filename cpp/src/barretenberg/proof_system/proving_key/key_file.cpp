@@ -0,0 +1,295 @@
+#include "key_file.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#endif
+
+namespace bonk {
+
+namespace {
+// Coefficients per independently hashed chunk of a polynomial; the chunks are hashed in parallel
+constexpr size_t CHECKSUM_CHUNK_SIZE = 1UL << 14;
+
+inline uint64_t mix_checksum(uint64_t hash, const uint64_t word)
+{
+    hash ^= word * 0x9e3779b97f4a7c15ULL;
+    hash = (hash << 31) | (hash >> 33);
+    return hash * 0xbf58476d1ce4e5b9ULL;
+}
+
+// Bytes taken by a polynomial in the file. The room for one more coefficient (zero) keeps reads of the coefficient at
+// size(), which Polynomial allows for, inside the mapping.
+uint64_t get_region_size(const uint64_t size)
+{
+    uint64_t num_bytes = (size + 1) * sizeof(barretenberg::fr);
+    return pad(num_bytes, KEY_FILE_ALIGNMENT);
+}
+
+std::vector<uint8_t> serialize_header(proving_key const& key, std::vector<key_file_entry> const& entries)
+{
+    using serialize::write;
+    std::vector<uint8_t> buf;
+    write(buf, KEY_FILE_MAGIC);
+    write(buf, KEY_FILE_VERSION);
+    write(buf, key.composer_type);
+    write(buf, static_cast<uint32_t>(key.circuit_size));
+    write(buf, static_cast<uint32_t>(key.num_public_inputs));
+    write(buf, key.contains_recursive_proof);
+    write(buf, key.recursive_proof_public_input_indices);
+    write(buf, key.memory_read_records);
+    write(buf, key.memory_write_records);
+    write(buf, static_cast<uint32_t>(entries.size()));
+    for (auto& entry : entries) {
+        write(buf, entry);
+    }
+    return buf;
+}
+
+/**
+ * Reads the header of a mapped key file, checking every field against the end of the file before it is read, so that a
+ * truncated or corrupt header fails with an error rather than reading past the mapping.
+ */
+class key_file_header_reader {
+  public:
+    key_file_header_reader(const uint8_t* begin, const size_t file_size, std::string const& filename)
+        : it_(begin)
+        , end_(begin + file_size)
+        , filename_(filename)
+    {}
+
+    template <typename T> std::enable_if_t<std::is_integral_v<T>> read(T& value)
+    {
+        require(sizeof(T));
+        serialize::read(it_, value);
+    }
+
+    void read(std::vector<uint32_t>& value)
+    {
+        uint32_t size = 0;
+        read(size);
+        require(static_cast<uint64_t>(size) * sizeof(uint32_t));
+        value.resize(size);
+        for (auto& element : value) {
+            serialize::read(it_, element);
+        }
+    }
+
+    void read(std::string& value)
+    {
+        uint32_t size = 0;
+        read(size);
+        require(size);
+        value.assign(reinterpret_cast<const char*>(it_), size);
+        it_ += size;
+    }
+
+    void read(key_file_entry& entry)
+    {
+        uint8_t form = 0;
+        read(entry.label);
+        read(form);
+        read(entry.offset);
+        read(entry.size);
+        read(entry.checksum);
+        entry.form = static_cast<KeyFilePolynomialForm>(form);
+    }
+
+    const uint8_t* get_position() const { return it_; }
+
+  private:
+    void require(const uint64_t num_bytes) const
+    {
+        if (num_bytes > static_cast<uint64_t>(end_ - it_)) {
+            throw_or_abort(format("Truncated proving key file header: ", filename_));
+        }
+    }
+
+    const uint8_t* it_;
+    const uint8_t* end_;
+    std::string const& filename_;
+};
+
+std::shared_ptr<void> map_key_file(std::string const& filename, size_t& file_size)
+{
+    struct stat st;
+    if (stat(filename.c_str(), &st) != 0) {
+        throw_or_abort("Filename not found: " + filename);
+    }
+    file_size = static_cast<size_t>(st.st_size);
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open: " + filename);
+    }
+#ifndef __wasm__
+    void* data = mmap(0, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw_or_abort("Failed to map: " + filename);
+    }
+    return std::shared_ptr<void>(data, [file_size](void* p) { munmap(p, file_size); });
+#else
+    void* data = aligned_alloc(KEY_FILE_ALIGNMENT, file_size);
+    // read() may return fewer bytes than requested
+    size_t num_read = 0;
+    while (num_read < file_size) {
+        const ssize_t result = ::read(fd, static_cast<uint8_t*>(data) + num_read, file_size - num_read);
+        if (result <= 0) {
+            close(fd);
+            aligned_free(data);
+            throw_or_abort(format("Failed to read: ", filename));
+        }
+        num_read += static_cast<size_t>(result);
+    }
+    close(fd);
+    return std::shared_ptr<void>(data, aligned_free);
+#endif
+}
+} // namespace
+
+KeyFilePolynomialForm get_key_file_polynomial_form(std::string const& label)
+{
+    if (label.ends_with("_lagrange")) {
+        return KeyFilePolynomialForm::LAGRANGE;
+    }
+    if (label.ends_with("_fft")) {
+        return KeyFilePolynomialForm::COSET;
+    }
+    return KeyFilePolynomialForm::MONOMIAL;
+}
+
+uint64_t compute_key_file_checksum(const barretenberg::fr* coefficients, const size_t size)
+{
+    const size_t num_chunks = (size + CHECKSUM_CHUNK_SIZE - 1) / CHECKSUM_CHUNK_SIZE;
+    std::vector<uint64_t> chunk_checksums(num_chunks);
+    barretenberg::parallel_for(num_chunks, [&](const size_t chunks_start, const size_t chunks_end) {
+        for (size_t i = chunks_start; i < chunks_end; ++i) {
+            const size_t start = i * CHECKSUM_CHUNK_SIZE;
+            const size_t end = std::min(start + CHECKSUM_CHUNK_SIZE, size);
+            uint64_t hash = i;
+            for (size_t j = start; j < end; ++j) {
+                for (size_t k = 0; k < 4; ++k) {
+                    hash = mix_checksum(hash, coefficients[j].data[k]);
+                }
+            }
+            chunk_checksums[i] = hash;
+        }
+    });
+    uint64_t checksum = size;
+    for (auto chunk_checksum : chunk_checksums) {
+        checksum = mix_checksum(checksum, chunk_checksum);
+    }
+    return checksum;
+}
+
+void write_key_file(std::string const& filename, proving_key const& key)
+{
+    auto& polynomial_store = const_cast<proving_key&>(key).polynomial_store;
+    PrecomputedPolyList precomputed_poly_list(key.composer_type);
+
+    std::vector<key_file_entry> entries;
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        std::string label = precomputed_poly_list[i];
+        const barretenberg::polynomial& value = polynomial_store.get(label);
+        entries.push_back({ label,
+                            get_key_file_polynomial_form(label),
+                            0,
+                            value.size(),
+                            compute_key_file_checksum(value.data(), value.size()) });
+    }
+
+    // The offsets are fixed width, so the header's length does not depend on their values
+    uint64_t header_size = serialize_header(key, entries).size();
+    uint64_t offset = pad(header_size, KEY_FILE_ALIGNMENT);
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset += get_region_size(entry.size);
+    }
+    std::vector<uint8_t> header = serialize_header(key, entries);
+
+    std::ofstream os(filename, std::ios::binary);
+    std::vector<char> zeros(KEY_FILE_ALIGNMENT + sizeof(barretenberg::fr), 0);
+    os.write((char*)header.data(), (std::streamsize)header.size());
+    os.write(zeros.data(), (std::streamsize)(entries.empty() ? 0 : entries[0].offset - header.size()));
+    for (auto& entry : entries) {
+        const barretenberg::polynomial& value = polynomial_store.get(entry.label);
+        const uint64_t num_bytes = entry.size * sizeof(barretenberg::fr);
+        os.write((char*)value.data(), (std::streamsize)num_bytes);
+        os.write(zeros.data(), (std::streamsize)(get_region_size(entry.size) - num_bytes));
+    }
+    if (!os.good()) {
+        throw_or_abort(format("Failed to write: ", filename));
+    }
+}
+
+void read_key_file(std::string const& filename, proving_key_data& key, const bool check_integrity)
+{
+    size_t file_size = 0;
+    std::shared_ptr<void> mapping = map_key_file(filename, file_size);
+    auto* base = static_cast<uint8_t*>(mapping.get());
+
+    key_file_header_reader reader(base, file_size, filename);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (file_size < 2 * sizeof(uint32_t)) {
+        throw_or_abort(format("Not a proving key file: ", filename));
+    }
+    reader.read(magic);
+    reader.read(version);
+    if (magic != KEY_FILE_MAGIC) {
+        throw_or_abort(format("Not a proving key file: ", filename));
+    }
+    if (version != KEY_FILE_VERSION) {
+        throw_or_abort(format("Unsupported proving key file version ", version, ": ", filename));
+    }
+
+    reader.read(key.composer_type);
+    reader.read(key.circuit_size);
+    reader.read(key.num_public_inputs);
+    reader.read(key.contains_recursive_proof);
+    reader.read(key.recursive_proof_public_input_indices);
+    reader.read(key.memory_read_records);
+    reader.read(key.memory_write_records);
+    uint32_t num_entries = 0;
+    reader.read(num_entries);
+    std::vector<key_file_entry> entries;
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        key_file_entry entry;
+        reader.read(entry);
+        entries.push_back(std::move(entry));
+    }
+
+    const auto header_size = static_cast<uint64_t>(reader.get_position() - base);
+    for (auto& entry : entries) {
+        // The region includes the zero coefficient after the polynomial. Its size is only computed once the number of
+        // coefficients is known to be small enough for the region to fit in the file, so it cannot overflow.
+        const bool region_in_file = entry.offset <= file_size &&
+                                    entry.size < (file_size - entry.offset) / sizeof(barretenberg::fr) &&
+                                    get_region_size(entry.size) <= file_size - entry.offset;
+        if (entry.offset < header_size || entry.offset % KEY_FILE_ALIGNMENT != 0 || !region_in_file) {
+            throw_or_abort(format("Corrupt proving key file index at ", entry.label, ": ", filename));
+        }
+        if (entry.form != get_key_file_polynomial_form(entry.label)) {
+            throw_or_abort(format("Unexpected form for ", entry.label, " in proving key file: ", filename));
+        }
+    }
+
+    if (check_integrity) {
+        for (auto& entry : entries) {
+            auto* coefficients = reinterpret_cast<const barretenberg::fr*>(base + entry.offset);
+            if (compute_key_file_checksum(coefficients, entry.size) != entry.checksum) {
+                throw_or_abort(format("Checksum mismatch for ", entry.label, " in proving key file: ", filename));
+            }
+        }
+    }
+
+    for (auto& entry : entries) {
+        auto* coefficients = reinterpret_cast<barretenberg::fr*>(base + entry.offset);
+        key.polynomial_store.put(entry.label, barretenberg::polynomial(mapping, coefficients, entry.size));
+    }
+}
+
+} // namespace bonk
@@ -0,0 +1,67 @@
+#pragma once
+#include "proving_key.hpp"
+#include "barretenberg/common/serialize.hpp"
+
+namespace bonk {
+
+/**
+ * A proving key file holds everything in proving_key_data in a single file:
+ *
+ *   - a header: magic, version, the key's metadata (composer type, sizes, recursive proof indices, memory records) and
+ *     an index with one key_file_entry per precomputed polynomial;
+ *   - the polynomials, each at a KEY_FILE_ALIGNMENT-aligned offset and followed by zeros up to the next one.
+ *
+ * Reading maps the file once. Every polynomial in the resulting store is a read only view into that mapping, so loading
+ * neither copies coefficients nor opens a file per polynomial. The mapping lives until the last view is destroyed.
+ */
+constexpr uint32_t KEY_FILE_MAGIC = 0x424b4559; // "BKEY"
+constexpr uint32_t KEY_FILE_VERSION = 1;
+constexpr uint64_t KEY_FILE_ALIGNMENT = 64;
+
+enum class KeyFilePolynomialForm : uint8_t { MONOMIAL, LAGRANGE, COSET };
+
+struct key_file_entry {
+    std::string label;
+    KeyFilePolynomialForm form;
+    // from the start of the file
+    uint64_t offset;
+    // number of coefficients
+    uint64_t size;
+    uint64_t checksum;
+};
+
+template <typename B> inline void read(B& any, key_file_entry& entry)
+{
+    using serialize::read;
+    uint8_t form;
+    read(any, entry.label);
+    read(any, form);
+    read(any, entry.offset);
+    read(any, entry.size);
+    read(any, entry.checksum);
+    entry.form = static_cast<KeyFilePolynomialForm>(form);
+}
+
+template <typename B> inline void write(B& buf, key_file_entry const& entry)
+{
+    using serialize::write;
+    write(buf, entry.label);
+    write(buf, static_cast<uint8_t>(entry.form));
+    write(buf, entry.offset);
+    write(buf, entry.size);
+    write(buf, entry.checksum);
+}
+
+KeyFilePolynomialForm get_key_file_polynomial_form(std::string const& label);
+
+uint64_t compute_key_file_checksum(const barretenberg::fr* coefficients, const size_t size);
+
+void write_key_file(std::string const& filename, proving_key const& key);
+
+/**
+ * @brief Read a file written by write_key_file into `key`. With `check_integrity`, the checksum of every polynomial is
+ * verified (in parallel) before any of them is used, which touches every page of the file.
+ */
+void read_key_file(std::string const& filename, proving_key_data& key, const bool check_integrity = false);
+
+} // namespace bonk
@@ -4,7 +4,8 @@
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 namespace bonk {
 
-// In all the constructors below, the pippenger_runtime_state takes (n + 1) as the input
+// The proving key does not own a pippenger_runtime_state; MSMs check one out of the process-wide
+// scalar_multiplication::get_runtime_state_pool(). Those MSMs are of size up to (n + 1)
 // as the degree of t_{high}(X) is (n + 1) for standard plonk. Refer to
 // ./src/barretenberg/plonk/proof_system/prover/prover.cpp/ProverBase::compute_quotient_commitments
 // for more details on this.
@@ -32,7 +33,6 @@ proving_key::proving_key(const size_t num_gates,
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
-    , pippenger_runtime_state(circuit_size + 1)
     , polynomial_manifest((uint32_t)type)
 {
     init();
@@ -50,18 +50,35 @@ proving_key::proving_key(proving_key_data&& data, std::shared_ptr<ProverReferenc
     , num_public_inputs(data.num_public_inputs)
     , contains_recursive_proof(data.contains_recursive_proof)
     , recursive_proof_public_input_indices(std::move(data.recursive_proof_public_input_indices))
-    , memory_read_records(data.memory_read_records)
-    , memory_write_records(data.memory_write_records)
-    , polynomial_store(data.polynomial_store)
+    , memory_read_records(std::move(data.memory_read_records))
+    , memory_write_records(std::move(data.memory_write_records))
+    , polynomial_store(std::move(data.polynomial_store))
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
-    , pippenger_runtime_state(circuit_size + 1)
     , polynomial_manifest(data.composer_type)
 {
     init();
 }
 
+proving_key::proving_key(std::shared_ptr<proving_key> const& precomputed)
+    : composer_type(precomputed->composer_type)
+    , circuit_size(precomputed->circuit_size)
+    , log_circuit_size(precomputed->log_circuit_size)
+    , num_public_inputs(precomputed->num_public_inputs)
+    , contains_recursive_proof(precomputed->contains_recursive_proof)
+    , recursive_proof_public_input_indices(precomputed->recursive_proof_public_input_indices)
+    , memory_read_records(precomputed->memory_read_records)
+    , memory_write_records(precomputed->memory_write_records)
+    , polynomial_store(precomputed->polynomial_store.create_views(precomputed))
+    , small_domain(precomputed->small_domain)
+    , large_domain(precomputed->large_domain)
+    , reference_string(precomputed->reference_string)
+    , polynomial_manifest(precomputed->polynomial_manifest)
+{
+    init_quotient_polynomial_parts();
+}
+
 /**
  * Initialize proving key.
  *
@@ -75,7 +92,11 @@ void proving_key::init()
         small_domain.compute_lookup_table();
         large_domain.compute_lookup_table();
     }
+    init_quotient_polynomial_parts();
+}
 
+void proving_key::init_quotient_polynomial_parts()
+{
     // t_i for i = 1,2,3 have n+1 coefficients after blinding. t_4 has only n coefficients.
     quotient_polynomial_parts[0] = barretenberg::polynomial(circuit_size + 1);
     quotient_polynomial_parts[1] = barretenberg::polynomial(circuit_size + 1);
@@ -1,5 +1,5 @@
 #pragma once
-#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_states.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_state_pool.hpp"
 #include <map>
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -40,8 +40,18 @@ struct proving_key {
 
     proving_key(std::ostream& is, std::string const& crs_path);
 
+    /**
+     * A key for one of several proofs of the same circuit in flight at once. Its polynomials are read only views of
+     * those of `precomputed`, and its domains are copies; what a proof writes to its key (the witness, the polynomials
+     * the prover computes, the quotient polynomial parts) is the key's own. `precomputed` is kept alive by the key, and
+     * must be left unchanged while it lives.
+     */
+    explicit proving_key(std::shared_ptr<proving_key> const& precomputed);
+
     void init();
 
+    void init_quotient_polynomial_parts();
+
     uint32_t composer_type;
     size_t circuit_size;
     size_t log_circuit_size;
@@ -62,8 +72,6 @@ struct proving_key {
 
     barretenberg::polynomial quotient_polynomial_parts[plonk::NUM_QUOTIENT_PARTS];
 
-    barretenberg::scalar_multiplication::pippenger_runtime_state pippenger_runtime_state;
-
     PolynomialManifest polynomial_manifest;
 
     static constexpr size_t min_thread_block = 4UL;
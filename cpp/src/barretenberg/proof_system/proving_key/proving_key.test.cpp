@@ -2,6 +2,7 @@
 #include "barretenberg/common/streams.hpp"
 #include "proving_key.hpp"
 #include "serialize.hpp"
+#include "key_file.hpp"
 #include "barretenberg/plonk/composer/standard_composer.hpp"
 
 #ifndef __wasm__
@@ -113,4 +114,131 @@ TEST(proving_key, proving_key_from_mmaped_key)
     EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
 }
+
+// Test that a key read with read_mmap maps its polynomials on first use, and that the prover releases them again
+TEST(proving_key, proving_key_from_lazily_mapped_key)
+{
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+
+    std::string pk_dir = "../src/barretenberg/proof_system/proving_key/fixtures/lazy";
+    std::filesystem::create_directories(pk_dir);
+    std::string pk_path = pk_dir + "/proving_key";
+    std::ofstream os(pk_path);
+    bonk::proving_key& p_key = *composer.compute_proving_key();
+    write_mmap(os, pk_dir, p_key);
+    os.close();
+
+    std::ifstream pk_stream = std::ifstream(pk_path);
+    bonk::proving_key_data pk_data;
+    read_mmap(pk_stream, pk_dir, pk_data);
+    pk_stream.close();
+
+    // Nothing is mapped until the polynomials are asked for
+    bonk::PrecomputedPolyList precomputed_poly_list(p_key.composer_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        EXPECT_TRUE(pk_data.polynomial_store.contains(precomputed_poly_list[i]));
+        EXPECT_FALSE(pk_data.polynomial_store.is_loaded(precomputed_poly_list[i]));
+    }
+    EXPECT_EQ(pk_data.polynomial_store.get_size_in_bytes(), 0UL);
+
+    auto crs = std::make_unique<bonk::FileReferenceStringFactory>("../srs_db/ignition");
+    auto lazy_key =
+        std::make_shared<bonk::proving_key>(std::move(pk_data), crs->get_prover_crs(pk_data.circuit_size + 1));
+
+    std::string poly_id = precomputed_poly_list[0];
+    EXPECT_EQ(lazy_key->polynomial_store.get(poly_id), p_key.polynomial_store.get(poly_id));
+    EXPECT_TRUE(lazy_key->polynomial_store.get(poly_id).mapped());
+    lazy_key->polynomial_store.release(poly_id);
+    EXPECT_FALSE(lazy_key->polynomial_store.is_loaded(poly_id));
+
+    // Prove the same circuit from the lazily mapped key
+    plonk::StandardComposer lazy_composer = plonk::StandardComposer(lazy_key, composer.compute_verification_key());
+    lazy_composer.add_public_variable(a);
+    auto prover = lazy_composer.create_prover();
+    plonk::proof proof = prover.construct_proof();
+
+    // By the end of the proof, every precomputed polynomial has been released again
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        EXPECT_FALSE(lazy_key->polynomial_store.is_loaded(precomputed_poly_list[i]));
+    }
+
+    auto verifier = composer.create_verifier();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    // Constructing the quotient in four blocks sets the key's coset FFTs aside; they come back as lazy entries
+    plonk::StandardComposer blocked_composer = plonk::StandardComposer(lazy_key, composer.compute_verification_key());
+    blocked_composer.add_public_variable(a);
+    auto blocked_prover = blocked_composer.create_prover();
+    blocked_prover.set_quotient_block_target(1);
+    plonk::proof blocked_proof = blocked_prover.construct_proof();
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        EXPECT_FALSE(lazy_key->polynomial_store.is_loaded(precomputed_poly_list[i]));
+        EXPECT_FALSE(lazy_key->polynomial_store.get_lazy_filename(precomputed_poly_list[i]).empty());
+    }
+    EXPECT_TRUE(verifier.verify_proof(blocked_proof));
+}
+
+// Test that a proving key survives a round trip through a proving key file, and that corruption is detected
+TEST(proving_key, proving_key_from_key_file)
+{
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+
+    bonk::proving_key& p_key = *composer.compute_proving_key();
+    p_key.contains_recursive_proof = true;
+    p_key.recursive_proof_public_input_indices = { 0, 1, 2 };
+    p_key.memory_read_records = { 3, 4 };
+    p_key.memory_write_records = { 5 };
+
+    std::string pk_dir = "../src/barretenberg/proof_system/proving_key/fixtures";
+    std::filesystem::create_directories(pk_dir);
+    std::string pk_path = pk_dir + "/proving_key.dat";
+    write_key_file(pk_path, p_key);
+
+    bonk::proving_key_data pk_data;
+    read_key_file(pk_path, pk_data, true);
+
+    bonk::PrecomputedPolyList precomputed_poly_list(p_key.composer_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        std::string poly_id = precomputed_poly_list[i];
+        auto& output_poly = pk_data.polynomial_store.get(poly_id);
+        EXPECT_EQ(p_key.polynomial_store.get(poly_id), output_poly);
+        EXPECT_TRUE(output_poly.mapped());
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(output_poly.data()) % KEY_FILE_ALIGNMENT, 0UL);
+    }
+    EXPECT_EQ(p_key.composer_type, pk_data.composer_type);
+    EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
+    EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
+    EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+    EXPECT_EQ(p_key.recursive_proof_public_input_indices, pk_data.recursive_proof_public_input_indices);
+    EXPECT_EQ(p_key.memory_read_records, pk_data.memory_read_records);
+    EXPECT_EQ(p_key.memory_write_records, pk_data.memory_write_records);
+
+    // Flip the bits of a byte in the last coefficient of the last polynomial, which is followed by a zero coefficient
+    // and 32 bytes of padding
+    {
+        std::fstream fs(pk_path, std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekg(-static_cast<std::streamoff>(3 * sizeof(fr)), std::ios::end);
+        auto position = fs.tellg();
+        char byte = static_cast<char>(fs.get());
+        fs.seekp(position);
+        fs.put(static_cast<char>(~byte));
+    }
+    bonk::proving_key_data unchecked_data;
+    EXPECT_NO_THROW(read_key_file(pk_path, unchecked_data));
+    bonk::proving_key_data checked_data;
+    EXPECT_THROW(read_key_file(pk_path, checked_data, true), std::runtime_error);
+
+    // A file cut short, whether in its last polynomial's trailing zero coefficient or in its header, is rejected
+    const auto file_size = std::filesystem::file_size(pk_path);
+    std::filesystem::resize_file(pk_path, file_size - sizeof(fr));
+    bonk::proving_key_data truncated_data;
+    EXPECT_THROW(read_key_file(pk_path, truncated_data), std::runtime_error);
+    std::filesystem::resize_file(pk_path, 64);
+    bonk::proving_key_data truncated_header_data;
+    EXPECT_THROW(read_key_file(pk_path, truncated_header_data), std::runtime_error);
+}
 #endif
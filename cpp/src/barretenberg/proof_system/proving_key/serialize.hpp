@@ -61,6 +61,11 @@ template <typename B> inline void write(B& buf, proving_key const& key)
     write(buf, key.memory_write_records);
 }
 
+/**
+ * @brief Read a proving key written by write_mmap. The polynomials are not read here: each is registered with the
+ * PolynomialStore to be mapped from its file under `path` when the prover first asks for it (see
+ * PolynomialStore::put_lazy).
+ */
 template <typename B> inline void read_mmap(B& is, std::string const& path, proving_key_data& key)
 {
     using serialize::read;
@@ -75,8 +80,7 @@ template <typename B> inline void read_mmap(B& is, std::string const& path, prov
     for (size_t i = 0; i < size; ++i) {
         std::string name;
         read(is, name);
-        barretenberg::polynomial value(format(path, "/", file_num++, "_", name));
-        key.polynomial_store.put(name, std::move(value));
+        key.polynomial_store.put_lazy(name, format(path, "/", file_num++, "_", name));
     }
     read(is, key.contains_recursive_proof);
     read(is, key.recursive_proof_public_input_indices);
@@ -1,10 +1,22 @@
 #include "work_queue.hpp"
 
-#include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/common/timer.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/runtime_state_pool.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
+#include <algorithm>
+
 namespace bonk {
 
+namespace {
+#ifdef NO_MULTITHREADING
+// without threads, a job runs when it is collected
+constexpr std::launch JOB_LAUNCH_POLICY = std::launch::deferred;
+#else
+constexpr std::launch JOB_LAUNCH_POLICY = std::launch::async;
+#endif
+} // namespace
+
 work_queue::work_queue(proving_key* prover_key, transcript::StandardTranscript* prover_transcript)
     : key(prover_key)
     , transcript(prover_transcript)
@@ -144,9 +156,16 @@ void work_queue::put_scalar_multiplication_data(const barretenberg::g1::affine_e
 
 void work_queue::flush_queue()
 {
+    collect_jobs(false, true);
     work_item_queue = std::vector<work_item>();
 }
 
+void work_queue::reset_round_timings()
+{
+    collect_jobs(false, false);
+    timings.clear();
+}
+
 void work_queue::add_to_queue(const work_item& item)
 {
 #if defined(__wasm__)
@@ -192,58 +211,217 @@ void work_queue::add_to_queue(const work_item& item)
 #endif
 }
 
-void work_queue::process_queue()
+template <typename Func> void work_queue::launch(const std::shared_ptr<job>& new_job, Func&& func)
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // We use the variable work_item::constant to set the size of the multi-scalar multiplication.
-            // Note that a size (n+1) MSM is always needed to commit to the quotient polynomial parts t_1, t_2
-            // and t_3 for Standard/Turbo/Ultra due to the addition of blinding factors
-            size_t msm_size = 0;
-            barretenberg::g1::affine_element* srs_points;
-            switch (static_cast<size_t>(uint256_t(item.constant))) {
-            case MSMType::MONOMIAL_N: {
-                if (key->reference_string->get_monomial_size() < key->small_domain.size) {
-                    info("MSM: Monomial reference string size: ",
-                         key->reference_string->get_monomial_size(),
-                         ", required size: ",
-                         key->small_domain.size);
-                }
-                msm_size = key->small_domain.size;
-                srs_points = key->reference_string->get_monomial_points();
-                break;
+    job* j = new_job.get();
+    new_job->done = std::async(JOB_LAUNCH_POLICY, [j, func = std::forward<Func>(func)]() {
+                        Timer timer;
+                        func(*j);
+                        j->seconds = timer.seconds();
+                    }).share();
+    pending_jobs.push_back(new_job);
+}
+
+void work_queue::launch_scalar_multiplications()
+{
+    // Every MSM of a given type is computed against the same SRS points and has the same size, so we can run all of
+    // them in a single batched pippenger pass (one wnaf/sort/bucket-accumulation sweep for the whole group)
+    for (const size_t msm_type : { MSMType::MONOMIAL_N, MSMType::MONOMIAL_N_PLUS_ONE }) {
+        std::vector<std::string> tags;
+        std::vector<barretenberg::fr*> scalars;
+        for (const auto& item : work_item_queue) {
+            if (item.work_type == WorkType::SCALAR_MULTIPLICATION &&
+                static_cast<size_t>(uint256_t(item.constant)) == msm_type) {
+                tags.push_back(item.tag);
+                scalars.push_back(item.mul_scalars);
             }
-            case MSMType::MONOMIAL_N_PLUS_ONE: {
-                if (key->reference_string->get_monomial_size() < key->small_domain.size + 1) {
-                    info("MSM: Monomial reference string size: ",
-                         key->reference_string->get_monomial_size(),
-                         ", required size: ",
-                         key->small_domain.size + 1);
-                }
-                msm_size = key->small_domain.size + 1;
-                srs_points = key->reference_string->get_monomial_points();
-                break;
+        }
+        if (tags.empty()) {
+            continue;
+        }
+
+        // We use the variable work_item::constant to set the size of the multi-scalar multiplication.
+        // Note that a size (n+1) MSM is always needed to commit to the quotient polynomial parts t_1, t_2
+        // and t_3 for Standard/Turbo/Ultra due to the addition of blinding factors
+        const size_t msm_size = (msm_type == MSMType::MONOMIAL_N_PLUS_ONE) ? key->small_domain.size + 1
+                                                                            : key->small_domain.size;
+        if (key->reference_string->get_monomial_size() < msm_size) {
+            info("MSM: Monomial reference string size: ",
+                 key->reference_string->get_monomial_size(),
+                 ", required size: ",
+                 msm_size);
+        }
+        barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+
+        auto new_job = std::make_shared<job>(WorkType::SCALAR_MULTIPLICATION, timings.size() - 1, std::move(tags));
+        launch(new_job, [scalars, srs_points, msm_size](job& j) {
+            // Run pippenger multi-scalar multiplication, reusing a runtime state from the process-wide pool.
+            const auto results = barretenberg::scalar_multiplication::get_runtime_state_pool().pippenger_batch_unsafe(
+                scalars, srs_points, msm_size);
+            for (const auto& result : results) {
+                j.commitments.emplace_back(result);
             }
-            default: {
-                info("Incorrect item constant value: ", static_cast<size_t>(uint256_t(item.constant)));
-                srs_points = key->reference_string->get_monomial_points();
+        });
+    }
+
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
+            const size_t msm_type = static_cast<size_t>(uint256_t(item.constant));
+            if (msm_type != MSMType::MONOMIAL_N && msm_type != MSMType::MONOMIAL_N_PLUS_ONE) {
+                info("Incorrect item constant value: ", msm_type);
             }
+        }
+    }
+}
+
+void work_queue::launch_iffts()
+{
+    // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+    using namespace barretenberg;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type != WorkType::IFFT) {
+            continue;
+        }
+        // retrieve wire in lagrange form
+        polynomial* wire_lagrange = &key->polynomial_store.get(item.tag + "_lagrange");
+        const evaluation_domain* domain = &key->small_domain;
+
+        auto new_job = std::make_shared<job>(WorkType::IFFT, timings.size() - 1, std::vector<std::string>{ item.tag });
+        // allocated here, so that an FFT job that depends on this one can refer to the result from the start
+        new_job->polynomials.emplace_back(key->circuit_size);
+        launch(new_job, [wire_lagrange, domain](job& j) {
+            // Compute wire monomial form via ifft on lagrange form
+            polynomial_arithmetic::ifft(&(*wire_lagrange)[0], &j.polynomials[0][0], *domain);
+        });
+    }
+}
+
+void work_queue::launch_ffts()
+{
+    // Every FFT item is a coset FFT over the large domain, so we transform all of them together: the batched coset FFT
+    // shares its twiddle factors between the polynomials
+    using namespace barretenberg;
+    if (defer_ffts) {
+        for (const auto& item : work_item_queue) {
+            if (item.work_type == WorkType::FFT) {
+                deferred_fft_tags.push_back(item.tag);
             }
+        }
+        return;
+    }
+    std::vector<std::string> tags;
+    std::vector<const polynomial*> sources;
+    std::vector<std::shared_future<void>> dependencies;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type != WorkType::FFT) {
+            continue;
+        }
+        tags.push_back(item.tag);
+        // the monomial form may still be being computed, by an IFFT job
+        const auto ifft_job = std::find_if(pending_jobs.rbegin(), pending_jobs.rend(), [&](const auto& pending) {
+            return pending->work_type == WorkType::IFFT && pending->tags[0] == item.tag;
+        });
+        if (ifft_job != pending_jobs.rend()) {
+            sources.push_back(&(*ifft_job)->polynomials[0]);
+            dependencies.push_back((*ifft_job)->done);
+        } else {
+            sources.push_back(&key->polynomial_store.get(item.tag));
+        }
+    }
+    if (tags.empty()) {
+        return;
+    }
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe(
-                item.mul_scalars, srs_points, msm_size, runtime_state));
+    const size_t n = key->circuit_size;
+    const evaluation_domain* domain = &key->large_domain;
+    auto new_job = std::make_shared<job>(WorkType::FFT, timings.size() - 1, std::move(tags));
+    launch(new_job, [sources, dependencies, n, domain](job& j) {
+        for (const auto& dependency : dependencies) {
+            dependency.wait();
+        }
+        for (const polynomial* source : sources) {
+            j.polynomials.emplace_back(*source, 4 * n + 4);
+        }
+        std::vector<fr*> coefficients;
+        for (auto& wire_fft : j.polynomials) {
+            coefficients.push_back(wire_fft.get_coefficients());
+        }
+
+        polynomial_arithmetic::coset_fft_batch(coefficients, *domain);
+
+        for (auto& wire_fft : j.polynomials) {
+            for (size_t i = 0; i < 4; i++) {
+                wire_fft[4 * n + i] = wire_fft[i];
+            }
+        }
+    });
+}
 
-            transcript->add_element(item.tag, result.to_buffer());
+void work_queue::collect_jobs(const bool scalar_multiplications_only, const bool add_wait_times)
+{
+    std::vector<std::shared_ptr<job>> collected;
+    std::vector<std::shared_ptr<job>> still_pending;
+    for (auto& pending : pending_jobs) {
+        if (scalar_multiplications_only && pending->work_type != WorkType::SCALAR_MULTIPLICATION) {
+            still_pending.push_back(std::move(pending));
+        } else {
+            collected.push_back(std::move(pending));
+        }
+    }
+    pending_jobs = std::move(still_pending);
 
+    // wait for every job before publishing any, as an FFT job may be reading the result of an IFFT job
+    for (const auto& collected_job : collected) {
+        Timer timer;
+        collected_job->done.get();
+        if (add_wait_times) {
+            timings[collected_job->round].critical_path += timer.seconds();
+        }
+    }
+    for (auto& collected_job : collected) {
+        round_timings& round = timings[collected_job->round];
+        const std::vector<std::string>& tags = collected_job->tags;
+        switch (collected_job->work_type) {
+        case WorkType::SCALAR_MULTIPLICATION: {
+            round.scalar_multiplications += collected_job->seconds;
+            for (size_t i = 0; i < tags.size(); ++i) {
+                transcript->add_element(tags[i], collected_job->commitments[i].to_buffer());
+            }
             break;
         }
+        case WorkType::FFT: {
+            round.ffts += collected_job->seconds;
+            for (size_t i = 0; i < tags.size(); ++i) {
+                key->polynomial_store.put(tags[i] + "_fft", std::move(collected_job->polynomials[i]));
+            }
+            break;
+        }
+        case WorkType::IFFT: {
+            round.iffts += collected_job->seconds;
+            key->polynomial_store.put(tags[0], std::move(collected_job->polynomials[0]));
+            break;
+        }
+        default: {
+        }
+        }
+    }
+}
+
+void work_queue::process_queue()
+{
+    Timer timer;
+    timings.emplace_back();
+
+    // the scalar multiplications first, as the prover waits for them
+    launch_scalar_multiplications();
+    // before the FFTs, which may start from the monomial forms the IFFTs compute
+    launch_iffts();
+    launch_ffts();
+
+    for (const auto& item : work_item_queue) {
         // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
         // due to the need to copy memory between web workers
-        case WorkType::SMALL_FFT: {
+        if (item.work_type == WorkType::SMALL_FFT) {
             using namespace barretenberg;
             const size_t n = key->circuit_size;
             polynomial& wire = key->polynomial_store.get(item.tag);
@@ -258,41 +436,12 @@ void work_queue::process_queue()
             wire_fft[4 * n + item.index] = wire_copy[0];
 
             key->polynomial_store.put(item.tag + "_fft", 4 * n + 4);
-
-            break;
-        }
-        case WorkType::FFT: {
-            using namespace barretenberg;
-            polynomial& wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
-            break;
-        }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace barretenberg;
-            // retrieve wire in lagrange form
-            polynomial& wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft(&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
-            break;
-        }
-        default: {
-        }
         }
     }
+
+    collect_jobs(true, false);
     work_item_queue = std::vector<work_item>();
+    timings.back().critical_path += timer.seconds();
 }
 
 std::vector<work_queue::work_item> work_queue::get_queue() const
@@ -300,4 +449,11 @@ std::vector<work_queue::work_item> work_queue::get_queue() const
     return work_item_queue;
 }
 
+std::vector<std::string> work_queue::release_deferred_ffts()
+{
+    std::vector<std::string> tags;
+    tags.swap(deferred_fft_tags);
+    return tags;
+}
+
 } // namespace bonk
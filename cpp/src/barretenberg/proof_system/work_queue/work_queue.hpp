@@ -3,6 +3,9 @@
 #include "../../transcript/transcript_wrappers.hpp"
 #include "../proving_key/proving_key.hpp"
 
+#include <future>
+#include <memory>
+
 namespace bonk {
 class work_queue {
 
@@ -29,11 +32,26 @@ class work_queue {
         barretenberg::fr shift_factor;
     };
 
+    /**
+     * Wall-clock times, in seconds, of the work items of one call to process_queue. The scalar multiplications, the
+     * FFTs and each IFFT run as concurrent jobs, so the time the prover spent blocked on them (`critical_path`) is less
+     * than the sum of the job times by however much the jobs overlapped one another and the prover's own work.
+     */
+    struct round_timings {
+        double critical_path = 0;
+        double scalar_multiplications = 0;
+        double ffts = 0;
+        double iffts = 0;
+
+        double get_overlap() const { return std::max(scalar_multiplications + ffts + iffts - critical_path, 0.0); }
+    };
+
     work_queue(proving_key* prover_key = nullptr, transcript::StandardTranscript* prover_transcript = nullptr);
 
-    work_queue(const work_queue& other) = default;
+    // the jobs a queue has started are not shared
+    work_queue(const work_queue& other) = delete;
     work_queue(work_queue&& other) = default;
-    work_queue& operator=(const work_queue& other) = default;
+    work_queue& operator=(const work_queue& other) = delete;
     work_queue& operator=(work_queue&& other) = default;
 
     work_item_info get_queued_work_item_info() const;
@@ -52,17 +70,83 @@ class work_queue {
 
     void put_scalar_multiplication_data(const barretenberg::g1::affine_element result, const size_t work_item_number);
 
+    /**
+     * Wait for the jobs still running, publish their results and empty the queue. Every round of the prover starts
+     * here, so the results of one round's work items are in place before the next round reads them.
+     */
     void flush_queue();
 
     void add_to_queue(const work_item& item);
 
+    /**
+     * Start the queued work items as concurrent jobs, then wait only for the scalar multiplications: their
+     * commitments go into the transcript, and the next Fiat-Shamir challenge depends on them. FFTs and IFFTs keep
+     * running, overlapping the rest of the round, until the next call to flush_queue. An FFT of a polynomial whose
+     * IFFT is still running waits for it.
+     */
     void process_queue();
 
+    // One entry for every call to process_queue since the last reset_round_timings
+    const std::vector<round_timings>& get_round_timings() const { return timings; }
+
+    // Waits for the jobs still running first, as their times belong to the rounds being cleared
+    void reset_round_timings();
+
     std::vector<work_item> get_queue() const;
 
+    /**
+     * While set, FFT work items are not processed. Their tags are collected instead, for a prover that evaluates these
+     * polynomials on one block of the coset at a time (see ProverBase::set_quotient_block_target).
+     */
+    void set_defer_ffts(const bool defer) { defer_ffts = defer; }
+
+    std::vector<std::string> release_deferred_ffts();
+
   private:
+    /**
+     * A batch of work items running on a thread of its own. The threads share the process-wide thread pool, whose idle
+     * threads steal work from whichever job has most. The results are published, to the transcript or the polynomial
+     * store, by the prover's thread when the job is collected, as neither is thread safe.
+     */
+    struct job {
+        job(const WorkType type, const size_t round_index, std::vector<std::string> item_tags)
+            : work_type(type)
+            , round(round_index)
+            , tags(std::move(item_tags))
+        {}
+
+        WorkType work_type;
+        // index into `timings`
+        size_t round;
+        std::vector<std::string> tags;
+        std::vector<barretenberg::g1::affine_element> commitments;
+        std::vector<barretenberg::polynomial> polynomials;
+        double seconds = 0;
+        // last, so that destroying a job waits for it before its results are destroyed
+        std::shared_future<void> done;
+    };
+
+    // Run `func(*new_job)` on a thread of its own, and add the job to the pending jobs
+    template <typename Func> void launch(const std::shared_ptr<job>& new_job, Func&& func);
+
+    void launch_scalar_multiplications();
+
+    void launch_iffts();
+
+    void launch_ffts();
+
+    /**
+     * Wait for the pending jobs (only the scalar multiplications, if `scalar_multiplications_only`) and publish their
+     * results. The waits count towards the critical path of the rounds that started the jobs if `add_wait_times`.
+     */
+    void collect_jobs(bool scalar_multiplications_only, bool add_wait_times);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    bool defer_ffts = false;
+    std::vector<std::string> deferred_fft_tags;
+    std::vector<std::shared_ptr<job>> pending_jobs;
+    std::vector<round_timings> timings;
 };
 } // namespace bonk
\ No newline at end of file
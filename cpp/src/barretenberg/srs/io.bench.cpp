@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include "barretenberg/common/mem.hpp"
+#include "io.hpp"
+#include <cstdint>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+constexpr const char* SRS_PATH = "../srs_db/ignition";
+constexpr size_t MIN_LOG_NUM_POINTS = 16;
+constexpr size_t MAX_LOG_NUM_POINTS = 18;
+
+/**
+ * Load `1 << state.range(0)` points, in chunks of `chunk_size` points, with or without the on-curve checks.
+ * A chunk size of SIZE_MAX reads each transcript file as a single chunk that is converted once it has been read, which
+ * is how transcripts were loaded before they were split into chunks.
+ */
+void read_transcript_g1(State& state, const size_t chunk_size, const bool check_points) noexcept
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    auto* monomials = (g1::affine_element*)aligned_alloc(64, sizeof(g1::affine_element) * num_points);
+    double megabytes_per_second = 0;
+    for (auto _ : state) {
+        io::transcript_read_stats stats =
+            io::read_transcript_g1(monomials, num_points, SRS_PATH, { check_points, chunk_size });
+        megabytes_per_second = stats.get_megabytes_per_second();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(num_points * sizeof(g1::affine_element)));
+    state.counters["MB/s"] = megabytes_per_second;
+    aligned_free(monomials);
+}
+} // namespace
+
+void read_transcript_g1_chunked(State& state) noexcept
+{
+    read_transcript_g1(state, io::DEFAULT_TRANSCRIPT_CHUNK_SIZE, true);
+}
+BENCHMARK(read_transcript_g1_chunked)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+
+void read_transcript_g1_chunked_unchecked(State& state) noexcept
+{
+    read_transcript_g1(state, io::DEFAULT_TRANSCRIPT_CHUNK_SIZE, false);
+}
+BENCHMARK(read_transcript_g1_chunked_unchecked)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(kMillisecond);
+
+void read_transcript_g1_whole_files(State& state) noexcept
+{
+    read_transcript_g1(state, SIZE_MAX, false);
+}
+BENCHMARK(read_transcript_g1_whole_files)->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,9 +1,15 @@
 #include "io.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
 #include <fstream>
 #include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
 
 namespace barretenberg {
 namespace io {
@@ -137,27 +143,79 @@ bool is_file_exist(std::string const& fileName)
     return infile.good();
 }
 
-void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir)
+namespace {
+// A contiguous range of points from one transcript file
+struct transcript_chunk {
+    size_t file_index;
+    // from the start of the file
+    size_t offset;
+    // index in `monomials` of the first point
+    size_t first_point;
+    size_t num_points;
+};
+
+// Ask the kernel to start reading a chunk; it lands in the page cache while we work on the current one
+void prefetch_transcript_chunk(std::vector<int> const& fds, transcript_chunk const& chunk)
+{
+#if defined(POSIX_FADV_WILLNEED) && !defined(__wasm__)
+    posix_fadvise(fds[chunk.file_index],
+                  static_cast<off_t>(chunk.offset),
+                  static_cast<off_t>(chunk.num_points * sizeof(g1::affine_element)),
+                  POSIX_FADV_WILLNEED);
+#else
+    (void)fds;
+    (void)chunk;
+#endif
+}
+
+bool read_transcript_chunk(std::vector<int> const& fds, transcript_chunk const& chunk, char* buffer)
 {
+    const size_t num_bytes = chunk.num_points * sizeof(g1::affine_element);
+    size_t num_read = 0;
+    while (num_read < num_bytes) {
+        const auto offset = static_cast<off_t>(chunk.offset + num_read);
+        const ssize_t result = pread(fds[chunk.file_index], buffer + num_read, num_bytes - num_read, offset);
+        if (result <= 0) {
+            return false;
+        }
+        num_read += static_cast<size_t>(result);
+    }
+    return true;
+}
+} // namespace
+
+transcript_read_stats read_transcript_g1(g1::affine_element* monomials,
+                                         size_t degree,
+                                         std::string const& dir,
+                                         transcript_read_options const& options)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const size_t chunk_size = std::max(options.chunk_size, 1UL);
+
+    // Split the points we need, across all the files, into chunks
+    std::vector<int> fds;
+    std::vector<std::string> paths;
+    std::vector<transcript_chunk> chunks;
     size_t num = 0;
     size_t num_read = 0;
     std::string path = get_transcript_path(dir, num);
-
     while (is_file_exist(path) && num_read < degree) {
         Manifest manifest;
         read_manifest(path, manifest);
-
-        auto offset = sizeof(Manifest);
         const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
-        const size_t g1_buffer_size = sizeof(fq) * 2 * num_to_read;
-
-        char* buffer = (char*)&monomials[num_read];
-        size_t size = 0;
 
-        // We must pass the size actually read to the second call, not the desired
-        // g1_buffer_size as the file may have been smaller than this.
-        read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-        byteswap(&monomials[num_read], size);
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            break;
+        }
+        for (size_t i = 0; i < num_to_read; i += chunk_size) {
+            chunks.push_back({ fds.size(),
+                               sizeof(Manifest) + i * sizeof(g1::affine_element),
+                               num_read + i,
+                               std::min(chunk_size, num_to_read - i) });
+        }
+        fds.push_back(fd);
+        paths.push_back(path);
 
         num_read += num_to_read;
         path = get_transcript_path(dir, ++num);
@@ -165,6 +223,9 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
 
     const bool monomial_srs_condition = num_read < degree;
     if (monomial_srs_condition) {
+        for (const int fd : fds) {
+            close(fd);
+        }
         throw_or_abort(format("Only read ",
                               num_read,
                               " points from ",
@@ -176,6 +237,65 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
                               "by editing `srs_db/download_ignition.sh` (but be careful, as this suggests you've "
                               "just changed a circuit to exceed a new 'power of two' boundary)."));
     }
+
+    const size_t num_threads = get_num_threads();
+    // The first chunk of every thread is requested up front, and each later chunk by the one num_threads before it
+    for (size_t i = 0; i < std::min(num_threads, chunks.size()); ++i) {
+        prefetch_transcript_chunk(fds, chunks[i]);
+    }
+
+    // Reading and converting cannot throw from within the parallel loop, so failures are counted and reported after
+    std::vector<uint8_t> chunk_read_failed(chunks.size(), 0);
+    std::vector<size_t> chunk_num_invalid_points(chunks.size(), 0);
+    parallel_for(chunks.size(), [&](const size_t chunks_start, const size_t chunks_end) {
+        for (size_t i = chunks_start; i < chunks_end; ++i) {
+            const transcript_chunk& chunk = chunks[i];
+            if (i + num_threads < chunks.size()) {
+                prefetch_transcript_chunk(fds, chunks[i + num_threads]);
+            }
+            g1::affine_element* points = &monomials[chunk.first_point];
+            if (!read_transcript_chunk(fds, chunk, reinterpret_cast<char*>(points))) {
+                chunk_read_failed[i] = 1;
+                continue;
+            }
+            byteswap(points, chunk.num_points * sizeof(g1::affine_element));
+            if (options.check_points) {
+                for (size_t j = 0; j < chunk.num_points; ++j) {
+                    if (!points[j].on_curve()) {
+                        ++chunk_num_invalid_points[i];
+                    }
+                }
+            }
+        }
+    });
+    for (const int fd : fds) {
+        close(fd);
+    }
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (chunk_read_failed[i]) {
+            throw_or_abort(format("Failed to read ",
+                                  chunks[i].num_points,
+                                  " points at offset ",
+                                  chunks[i].offset,
+                                  " of ",
+                                  paths[chunks[i].file_index],
+                                  "."));
+        }
+    }
+    size_t num_invalid_points = 0;
+    for (const size_t chunk_invalid_points : chunk_num_invalid_points) {
+        num_invalid_points += chunk_invalid_points;
+    }
+    if (num_invalid_points > 0) {
+        throw_or_abort(format(num_invalid_points, " points of the transcript in ", dir, " are not on the curve."));
+    }
+
+    transcript_read_stats stats;
+    stats.num_points = degree;
+    stats.num_bytes = degree * sizeof(g1::affine_element);
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
 }
 
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir)
@@ -17,7 +17,42 @@ struct Manifest {
     uint32_t start_from;
 };
 
-void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir);
+// Path of the `num`th monomial transcript file in `dir`
+std::string get_transcript_path(std::string const& dir, size_t num);
+
+// Points per chunk of a transcript that one thread reads and converts at a time (4MB)
+constexpr size_t DEFAULT_TRANSCRIPT_CHUNK_SIZE = 1UL << 16;
+
+struct transcript_read_options {
+    // Verify that every point is on the curve. The check costs a few field multiplications per point, so it is only
+    // worth asking for when the transcript comes from an untrusted source (e.g. it was just downloaded)
+    bool check_points = false;
+    size_t chunk_size = DEFAULT_TRANSCRIPT_CHUNK_SIZE;
+};
+
+struct transcript_read_stats {
+    size_t num_points = 0;
+    size_t num_bytes = 0;
+    double seconds = 0;
+
+    double get_megabytes_per_second() const
+    {
+        return seconds > 0 ? static_cast<double>(num_bytes) / 1e6 / seconds : 0;
+    }
+};
+
+/**
+ * Read the first `degree` g1 points of the transcript in `dir` into `monomials`, in native form.
+ *
+ * The points of all the transcript files are split into chunks of `options.chunk_size` points, which the threads
+ * take in turn: each reads its chunk straight into place, byteswaps it, converts it to Montgomery form and, if asked
+ * to, checks it. While a thread converts its chunk, the kernel is asked to start reading the chunks that come next,
+ * so that I/O and conversion overlap even on one thread.
+ */
+transcript_read_stats read_transcript_g1(g1::affine_element* monomials,
+                                         size_t degree,
+                                         std::string const& dir,
+                                         transcript_read_options const& options = {});
 
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir);
 
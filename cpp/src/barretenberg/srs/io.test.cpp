@@ -30,3 +30,21 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, read_transcript_g1_in_chunks)
+{
+    // small chunks, which do not divide the degree, must give the same points as reading each file in one go
+    size_t degree = 100000;
+    std::vector<g1::affine_element> expected(degree);
+    std::vector<g1::affine_element> monomials(degree);
+    io::read_transcript_g1(&expected[0], degree, "../srs_db/ignition", { false, degree });
+    io::transcript_read_stats stats =
+        io::read_transcript_g1(&monomials[0], degree, "../srs_db/ignition", { true, 999 });
+
+    EXPECT_EQ(stats.num_points, degree);
+    EXPECT_EQ(stats.num_bytes, degree * sizeof(g1::affine_element));
+    EXPECT_GT(stats.get_megabytes_per_second(), 0);
+    for (size_t i = 0; i < degree; ++i) {
+        EXPECT_EQ(monomials[i], expected[i]);
+    }
+}
@@ -35,9 +35,11 @@ class VerifierFileReferenceString : public VerifierReferenceString {
 
 class FileReferenceString : public ProverReferenceString {
   public:
-    FileReferenceString(const size_t num_points, std::string const& path)
+    FileReferenceString(const size_t num_points,
+                        std::string const& path,
+                        std::string const& point_table_cache_dir = scalar_multiplication::get_point_table_cache_dir())
         : num_points(num_points)
-        , pippenger_(path, num_points)
+        , pippenger_(path, num_points, point_table_cache_dir)
     {}
 
     g1::affine_element* get_monomial_points() override { return pippenger_.get_point_table(); }
@@ -49,17 +51,24 @@ class FileReferenceString : public ProverReferenceString {
     scalar_multiplication::Pippenger pippenger_;
 };
 
+/**
+ * Prover reference strings read from the transcript in `path`. With a `point_table_cache_dir`, which defaults to the
+ * directory in POINT_TABLE_CACHE_DIR_ENV_VAR, their point tables are shared with other processes through a cache file
+ * (see point_table_cache.hpp).
+ */
 class FileReferenceStringFactory : public ReferenceStringFactory {
   public:
-    FileReferenceStringFactory(std::string path)
+    FileReferenceStringFactory(std::string path,
+                               std::string point_table_cache_dir = scalar_multiplication::get_point_table_cache_dir())
         : path_(std::move(path))
+        , point_table_cache_dir_(std::move(point_table_cache_dir))
     {}
 
     FileReferenceStringFactory(FileReferenceStringFactory&& other) = default;
 
     std::shared_ptr<ProverReferenceString> get_prover_crs(size_t degree) override
     {
-        return std::make_shared<FileReferenceString>(degree, path_);
+        return std::make_shared<FileReferenceString>(degree, path_, point_table_cache_dir_);
     }
 
     std::shared_ptr<VerifierReferenceString> get_verifier_crs() override
@@ -69,12 +78,17 @@ class FileReferenceStringFactory : public ReferenceStringFactory {
 
   private:
     std::string path_;
+    std::string point_table_cache_dir_;
 };
 
 class DynamicFileReferenceStringFactory : public ReferenceStringFactory {
   public:
-    DynamicFileReferenceStringFactory(std::string path, size_t initial_degree = 0)
+    DynamicFileReferenceStringFactory(
+        std::string path,
+        size_t initial_degree = 0,
+        std::string point_table_cache_dir = scalar_multiplication::get_point_table_cache_dir())
         : path_(std::move(path))
+        , point_table_cache_dir_(std::move(point_table_cache_dir))
         , degree_(initial_degree)
         , verifier_crs_(std::make_shared<VerifierFileReferenceString>(path_))
     {}
@@ -84,7 +98,7 @@ class DynamicFileReferenceStringFactory : public ReferenceStringFactory {
     std::shared_ptr<ProverReferenceString> get_prover_crs(size_t degree) override
     {
         if (degree != degree_) {
-            prover_crs_ = std::make_shared<FileReferenceString>(degree, path_);
+            prover_crs_ = std::make_shared<FileReferenceString>(degree, path_, point_table_cache_dir_);
             degree_ = degree;
         }
         return prover_crs_;
@@ -94,6 +108,7 @@ class DynamicFileReferenceStringFactory : public ReferenceStringFactory {
 
   private:
     std::string path_;
+    std::string point_table_cache_dir_;
     size_t degree_;
     std::shared_ptr<FileReferenceString> prover_crs_;
     std::shared_ptr<VerifierFileReferenceString> verifier_crs_;